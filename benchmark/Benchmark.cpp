@@ -0,0 +1,770 @@
+#include <UIElements.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+/*------------------------------*/
+/*      Allocation counting     */
+/*------------------------------*/
+
+namespace
+{
+	std::size_t allocationCount = 0;	// The number of heap allocations made since the start of the program
+} // namespace
+
+void* operator new(std::size_t size)
+{
+	++allocationCount;
+
+	if (void* memory = std::malloc(size ? size : 1))
+		return memory;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	const unsigned int CharacterSize = 16;
+	const unsigned int ElementsPerRow = 10;
+	const sf::Vector2f ElementSize(150, 40);
+	const sf::Vector2u TargetSize(1920, 1080);
+
+	/**
+	 * @brief Ui-element without any visuals which counts how often its boundaries are queried
+	 */
+	class Probe : public uie::UIElement
+	{
+	private:
+		sf::FloatRect rect;	// The boundaries in the layout coordinates of the parent
+
+		sf::FloatRect toGlobal(const sf::FloatRect& rect) const
+		{
+			return { rect.getPosition() + getParentOffset(), rect.getSize() };
+		}
+
+	public:
+		static inline std::size_t boundsQueries = 0;	// The number of getGlobalBounds calls over all probes
+
+		Probe() = default;
+
+		Probe(const sf::FloatRect& rect)
+			: rect(rect)
+		{
+
+		}
+
+		sf::FloatRect getLocalBounds() const override
+		{
+			return { {}, rect.getSize() };
+		}
+
+		sf::FloatRect getGlobalBounds() const override
+		{
+			++boundsQueries;
+			return toGlobal(rect);
+		}
+
+		sf::Vector2f getPosition() const override
+		{
+			return rect.getPosition() + getParentOffset();
+		}
+
+		void setPosition(const sf::Vector2f& position) override
+		{
+			move(position - getPosition());
+		}
+
+		sf::Vector2f getSize() const override
+		{
+			return rect.getSize();
+		}
+
+		void setSize(const sf::Vector2f& size) override
+		{
+			rect.width = size.x;
+			rect.height = size.y;
+			markDirty();
+		}
+
+		void move(const sf::Vector2f& offset) override
+		{
+			rect.left += offset.x;
+			rect.top += offset.y;
+			markDirty();
+		}
+
+		bool intersects(const sf::Vector2f& point) const override
+		{
+			return toGlobal(rect).contains(point);
+		}
+
+		bool intersects(const sf::FloatRect& rect) const override
+		{
+			return toGlobal(this->rect).intersects(rect);
+		}
+
+		void draw(sf::RenderTarget&, sf::RenderStates) const override
+		{
+
+		}
+	};
+
+	/**
+	 * @brief Synthetic ui-tree, a vertical layout of horizontal rows with a mix of all ui-elements
+	 *
+	 * @details The elements are stored by value, the layouts only point to them
+	 */
+	struct Scene
+	{
+		std::vector<uie::Button> buttons;
+		std::vector<uie::Checkbox> checkboxes;
+		std::vector<uie::Text> texts;
+		std::vector<uie::Container<uie::Text>> containers;
+		std::vector<uie::LineLayout<>> rows;
+		uie::LineLayout<> root;
+
+		Scene(std::size_t elementCount, const sf::Font& font)
+			: root(sf::FloatRect(0, 0, static_cast<float>(TargetSize.x), static_cast<float>(TargetSize.y)), uie::LineLayout<>::Attributes{ .spacing = 5 })
+		{
+			std::size_t rowCount = (elementCount + ElementsPerRow - 1) / ElementsPerRow;
+
+			// The layouts point into the vectors, so they may never reallocate
+			buttons.reserve(elementCount / 4 + 1);
+			checkboxes.reserve(elementCount / 4 + 1);
+			texts.reserve(elementCount / 4 + 1);
+			containers.reserve(elementCount / 4 + 1);
+			rows.reserve(rowCount);
+
+			std::vector<uie::Any> rowElements;
+			std::vector<uie::Any> rootElements;
+			rootElements.reserve(rowCount);
+
+			for (std::size_t i = 0; i < elementCount; i++)
+			{
+				std::string label = "Element " + std::to_string(i);
+
+				switch (i % 4)
+				{
+				case 0:
+					rowElements.push_back(&buttons.emplace_back(sf::FloatRect({}, ElementSize), label, CharacterSize, font));
+					break;
+				case 1:
+					rowElements.push_back(&checkboxes.emplace_back(sf::FloatRect({}, { ElementSize.y, ElementSize.y }), label, CharacterSize, font));
+					break;
+				case 2:
+					rowElements.push_back(&texts.emplace_back(sf::Vector2f(), label, CharacterSize, font));
+					break;
+				case 3:
+					rowElements.push_back(&containers.emplace_back(sf::Vector2f(), ElementSize, uie::Text({}, label, CharacterSize, font)));
+					break;
+				}
+
+				if (rowElements.size() == ElementsPerRow || i + 1 == elementCount)
+				{
+					rootElements.push_back(&rows.emplace_back(sf::FloatRect(), uie::LineLayout<>::Attributes{ .axis = uie::Horizontal, .spacing = 5 }, rowElements));
+					rowElements.clear();
+				}
+			}
+
+			root.addElements(rootElements);
+		}
+	};
+
+	/**
+	 * @brief Timing results of a single benchmark case
+	 */
+	struct Timing
+	{
+		std::size_t iterations = 0;
+		double meanNs = 0;
+		double minNs = 0;
+		double maxNs = 0;
+	};
+
+	/**
+	 * @brief Result of a benchmark case, either a timing or the reason it was skipped
+	 */
+	struct Result
+	{
+		std::string name;
+		Timing timing;
+		std::string skipped;
+
+		Result(std::string name, const Timing& timing, std::string skipped = "")
+			: name(std::move(name)), timing(timing), skipped(std::move(skipped))
+		{
+
+		}
+	};
+
+	/**
+	 * @brief Results and counters for a single scale
+	 */
+	struct ScaleReport
+	{
+		std::size_t elements = 0;
+		std::vector<Result> results;
+		std::vector<std::pair<std::string, double>> counters;
+	};
+
+	/**
+	 * @brief Time a function
+	 *
+	 * @param[in] iterations The number of times to call the function
+	 * @param[in] function   The function to time
+	 *
+	 * @return The timing of a single call
+	 */
+	template <typename F>
+	Timing time(std::size_t iterations, F&& function)
+	{
+		Timing timing{ .iterations = iterations, .minNs = 1e300 };
+		double total = 0;
+
+		for (std::size_t i = 0; i < iterations; i++)
+		{
+			Clock::time_point start = Clock::now();
+			function(i);
+			double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+			total += ns;
+			timing.minNs = std::min(timing.minNs, ns);
+			timing.maxNs = std::max(timing.maxNs, ns);
+		}
+
+		timing.meanNs = total / iterations;
+		return timing;
+	}
+
+	/**
+	 * @brief Get the number of iterations for a scale, smaller scales are repeated more to reduce noise
+	 */
+	std::size_t iterationsFor(std::size_t elementCount)
+	{
+		return std::clamp<std::size_t>(100000 / std::max<std::size_t>(elementCount, 1), 3, 1000);
+	}
+
+	/**
+	 * @brief Fully lay out the scene, all rows are laid out before the root
+	 */
+	void layoutScene(Scene& scene)
+	{
+		for (uie::LineLayout<>& row : scene.rows)
+			row.correctContentPosition(true);
+
+		scene.root.correctContentPosition();
+	}
+
+	ScaleReport runScale(std::size_t elementCount, const sf::Font& font, sf::RenderTexture* texture)
+	{
+		ScaleReport report;
+		report.elements = elementCount;
+		std::size_t iterations = iterationsFor(elementCount);
+
+		report.results.push_back({ "construct", time(std::max<std::size_t>(iterations / 10, 1), [&](std::size_t)
+		{
+			Scene scene(elementCount, font);
+		}) });
+
+		// Building a ui-element and querying its boundaries should tessellate each rounded rectangle once
+		auto countTessellations = [&](const std::string& name, auto&& build)
+		{
+			std::size_t tessellations = sf::RoundedRectangleShape::getTessellationCount();
+			build().getGlobalBounds();
+			report.counters.push_back({ name, static_cast<double>(sf::RoundedRectangleShape::getTessellationCount() - tessellations) });
+		};
+
+		countTessellations("tessellationsPerButton", [&]()
+		{
+			return uie::Button(sf::FloatRect({}, ElementSize), "Button", CharacterSize, font);
+		});
+
+		countTessellations("tessellationsPerCheckbox", [&]()
+		{
+			return uie::Checkbox(sf::FloatRect({}, { ElementSize.y, ElementSize.y }), "Checkbox", CharacterSize, font);
+		});
+
+		Scene scene(elementCount, font);
+		sf::Vector2f rootSize = scene.root.getSize();
+
+		report.results.push_back({ "correctContentPosition", time(iterations, [&](std::size_t)
+		{
+			layoutScene(scene);
+		}) });
+
+		report.results.push_back({ "move", time(iterations, [&](std::size_t i)
+		{
+			scene.root.move({ i % 2 ? -1.0f : 1.0f, 0 });
+		}) });
+
+		if (iterations % 2)
+			scene.root.move({ -1, 0 });
+
+		report.results.push_back({ "setSize", time(iterations, [&](std::size_t i)
+		{
+			scene.root.setSize(rootSize + sf::Vector2f(i % 2 ? 0.0f : 10.0f, 0));
+		}) });
+
+		scene.root.setSize(rootSize);
+
+		// Random points over the visible area, tested the way an application does it without an index
+		std::vector<sf::Vector2f> points(1000);
+		std::mt19937 random(42);
+		std::uniform_real_distribution<float> x(0, static_cast<float>(TargetSize.x));
+		std::uniform_real_distribution<float> y(0, static_cast<float>(TargetSize.y));
+
+		for (sf::Vector2f& point : points)
+			point = { x(random), y(random) };
+
+		std::size_t hits = 0;
+
+		report.results.push_back({ "hitTest", time(iterations, [&](std::size_t)
+		{
+			for (const sf::Vector2f& point : points)
+				for (uie::LineLayout<>& row : scene.rows)
+					if (row.intersects(point))
+						for (uie::Any element : row.getElements())
+							hits += element->intersects(point);
+		}) });
+
+		std::size_t indexedHits = 0;
+
+		report.results.push_back({ "hitTestIndexed", time(iterations, [&](std::size_t)
+		{
+			for (const sf::Vector2f& point : points)
+				if (uie::Any row = scene.root.getElementAt(point))
+					indexedHits += static_cast<uie::LineLayout<>*>(row)->getElementAt(point) != nullptr;
+		}) });
+
+		std::vector<uie::UIElement*> batchHits(points.size());
+
+		report.results.push_back({ "hitTestBatch", time(iterations, [&](std::size_t)
+		{
+			scene.root.hitTest(points, batchHits);
+		}) });
+
+		// The same points against a single row, the case the batch loops are written for
+		uie::LineLayout<>& firstRow = scene.rows.front();
+		sf::FloatRect rowBounds = firstRow.getGlobalBounds();
+		std::vector<sf::Vector2f> rowPoints(points.size());
+
+		for (std::size_t i = 0; i < points.size(); i++)
+			rowPoints[i] = { rowBounds.left + points[i].x / TargetSize.x * rowBounds.width, rowBounds.top + points[i].y / TargetSize.y * rowBounds.height };
+
+		report.results.push_back({ "rowHitTest", time(iterations, [&](std::size_t)
+		{
+			for (std::size_t i = 0; i < rowPoints.size(); i++)
+				batchHits[i] = firstRow.hitTest(rowPoints[i]);
+		}) });
+
+		report.results.push_back({ "rowHitTestBatch", time(iterations, [&](std::size_t)
+		{
+			firstRow.hitTest(rowPoints, batchHits);
+		}) });
+
+		// A mouse sweeping over the scene in small steps, like the events of a high rate mouse
+		uie::EventDispatcher dispatcher(scene.root);
+		sf::Event mouseMove{ .type = sf::Event::MouseMoved, .mouseMove = {} };
+
+		report.results.push_back({ "dispatchMouseMove", time(iterations, [&](std::size_t)
+		{
+			for (int step = 0; step < 1000; step++)
+			{
+				mouseMove.mouseMove = { step, (step * 7) % static_cast<int>(TargetSize.y) };
+				dispatcher.handleEvent(mouseMove);
+			}
+		}) });
+
+		report.counters.push_back({ "dispatchSearchesPerMove", static_cast<double>(dispatcher.getSearchCount()) / (1000.0 * iterations) });
+
+		// Switching the colors of a style shared by all buttons and checkboxes
+		uie::Style style({ .outlineThickness = 1 }, {});
+
+		for (uie::Button& button : scene.buttons)
+			button.setStyle(&style);
+
+		for (uie::Checkbox& checkbox : scene.checkboxes)
+			checkbox.setStyle(&style);
+
+		scene.root.updateLayout();
+
+		report.results.push_back({ "themeSwitch", time(iterations, [&](std::size_t i)
+		{
+			style.setRectangleAttributes({ .fillColor = i % 2 ? sf::Color::White : sf::Color::Cyan, .outlineThickness = 1 });
+			scene.root.updateLayout();
+		}) });
+
+		for (uie::Button& button : scene.buttons)
+			button.setStyle(nullptr);
+
+		for (uie::Checkbox& checkbox : scene.checkboxes)
+			checkbox.setStyle(nullptr);
+
+		// Repositioning the text of every checkbox, as a relayout does
+		report.results.push_back({ "checkboxTextPosition", time(iterations, [&](std::size_t)
+		{
+			for (uie::Checkbox& checkbox : scene.checkboxes)
+				checkbox.correctTextPosition();
+		}) });
+
+		std::size_t checkboxAllocations = allocationCount;
+
+		for (uie::Checkbox& checkbox : scene.checkboxes)
+			checkbox.correctTextPosition();
+
+		report.counters.push_back({ "allocationsPerCheckboxTextPosition", static_cast<double>(allocationCount - checkboxAllocations) / std::max<std::size_t>(scene.checkboxes.size(), 1) });
+
+		report.results.push_back({ "textMeasure", time(iterations, [&](std::size_t i)
+		{
+			for (uie::Text& text : scene.texts)
+			{
+				text.setString(i % 2 ? "Measured" : "Measured text");
+				text.getLocalBounds();
+			}
+		}) });
+
+		std::vector<uie::RoundedRectangle> rectangles(elementCount, uie::RoundedRectangle(sf::Vector2f(), ElementSize));
+
+		report.results.push_back({ "tessellation", time(iterations, [&](std::size_t i)
+		{
+			for (uie::RoundedRectangle& rectangle : rectangles)
+			{
+				rectangle.setCornersRadius(i % 2 ? 4.0f : 8.0f);
+				rectangle.getLocalBounds();
+			}
+		}) });
+
+		layoutScene(scene);
+
+		if (texture)
+		{
+			report.results.push_back({ "draw", time(iterations, [&](std::size_t)
+			{
+				texture->clear();
+				texture->draw(scene.root);
+				texture->display();
+			}) });
+
+			uie::BatchRenderer renderer(*texture);
+
+			report.results.push_back({ "drawBatched", time(iterations, [&](std::size_t)
+			{
+				texture->clear();
+				renderer.draw(scene.root);
+				renderer.flush();
+				texture->display();
+			}) });
+
+			// Steady state, the batches reuse their memory
+			std::size_t allocations = allocationCount;
+			texture->clear();
+			renderer.draw(scene.root);
+			renderer.flush();
+			texture->display();
+
+			report.counters.push_back({ "allocationsPerBatchedFrame", static_cast<double>(allocationCount - allocations) });
+			report.counters.push_back({ "visibleRows", scene.root.getVisibleElementCount() });
+
+			// Submission counters of one frame, with and without merging the batches
+			uie::StatsRenderTarget stats(TargetSize);
+
+			for (unsigned int lookBehind : { stats.getLookBehind(), 0u })
+			{
+				std::string suffix = lookBehind ? "Batched" : "Unbatched";
+
+				stats.setLookBehind(lookBehind);
+				stats.reset();
+				stats.draw(scene.root);
+				stats.flush();
+
+				report.counters.push_back({ "drawCalls" + suffix, static_cast<double>(stats.getStats().drawCalls) });
+				report.counters.push_back({ "vertices" + suffix, static_cast<double>(stats.getStats().vertices) });
+				report.counters.push_back({ "textureBinds" + suffix, static_cast<double>(stats.getStats().textureBinds) });
+			}
+		}
+		else
+		{
+			report.results.push_back({ "draw", {}, "render texture unavailable" });
+			report.results.push_back({ "drawBatched", {}, "render texture unavailable" });
+		}
+
+		// Boundary queries made by a single layout pass
+		std::vector<Probe> probes;
+		probes.reserve(elementCount);
+
+		for (std::size_t i = 0; i < elementCount; i++)
+			probes.emplace_back(sf::FloatRect({}, ElementSize));
+
+		uie::LineLayout<Probe> probeLayout(sf::FloatRect({}, sf::Vector2f(TargetSize)), probes);
+		Probe::boundsQueries = 0;
+		probeLayout.correctContentPosition(true);
+
+		report.counters.push_back({ "boundsQueriesPerLayoutPass", static_cast<double>(Probe::boundsQueries) });
+		report.counters.push_back({ "boundsQueriesPerElement", static_cast<double>(Probe::boundsQueries) / std::max<std::size_t>(elementCount, 1) });
+		report.counters.push_back({ "hits", static_cast<double>(hits) });
+		report.counters.push_back({ "indexedHits", static_cast<double>(indexedHits) });
+
+		report.results.push_back({ "valueLayout", time(iterations, [&](std::size_t)
+		{
+			probeLayout.correctContentPosition(true);
+		}) });
+
+		// The same layout pass, with the elements in a registry pool and the layout storing handles
+		uie::ElementRegistry registry;
+		std::vector<uie::Handle<>> handles;
+		handles.reserve(elementCount);
+
+		for (std::size_t i = 0; i < elementCount; i++)
+			handles.push_back(registry.create<Probe>(sf::FloatRect({}, ElementSize)));
+
+		uie::LineLayout<uie::Handle<>> handleLayout(sf::FloatRect({}, sf::Vector2f(TargetSize)), handles);
+
+		report.results.push_back({ "handleLayout", time(iterations, [&](std::size_t)
+		{
+			handleLayout.correctContentPosition(true);
+		}) });
+
+		// Copying the buttons of the scene, the onClick functions are stored inline
+		std::vector<uie::Button> buttonCopies;
+		buttonCopies.reserve(scene.buttons.size());
+
+		report.results.push_back({ "copyButtons", time(std::max<std::size_t>(iterations / 10, 1), [&](std::size_t)
+		{
+			buttonCopies.assign(scene.buttons.begin(), scene.buttons.end());
+		}) });
+
+		std::size_t copyAllocations = allocationCount;
+		buttonCopies.assign(scene.buttons.begin(), scene.buttons.end());
+		report.counters.push_back({ "allocationsPerButtonCopy", static_cast<double>(allocationCount - copyAllocations) / std::max<std::size_t>(scene.buttons.size(), 1) });
+
+		// Adopting texts into a layout by copy, by move and by constructing them in place
+		auto countAdoption = [&](const std::string& name, auto&& adopt)
+		{
+			uie::LineLayout<uie::Text> layout(sf::FloatRect({}, sf::Vector2f(TargetSize)));
+			std::size_t allocations = allocationCount;
+			adopt(layout);
+			report.counters.push_back({ name, static_cast<double>(allocationCount - allocations) / std::max<std::size_t>(elementCount, 1) });
+		};
+
+		std::vector<uie::Text> sourceTexts;
+		sourceTexts.reserve(elementCount);
+
+		for (std::size_t i = 0; i < elementCount; i++)
+			sourceTexts.emplace_back(sf::Vector2f(), "Element " + std::to_string(i), CharacterSize, font);
+
+		countAdoption("allocationsPerAdoptedCopy", [&](uie::LineLayout<uie::Text>& layout)
+		{
+			layout.addElements(sourceTexts);
+		});
+
+		countAdoption("allocationsPerAdoptedMove", [&](uie::LineLayout<uie::Text>& layout)
+		{
+			layout.addElements(std::move(sourceTexts));
+		});
+
+		countAdoption("allocationsPerAdoptedEmplace", [&](uie::LineLayout<uie::Text>& layout)
+		{
+			layout.getElements().reserve(elementCount);
+
+			for (std::size_t i = 0; i < elementCount; i++)
+				layout.emplaceElement(sf::Vector2f(), "Element " + std::to_string(i), CharacterSize, font);
+		});
+
+		// Building and tearing down a screen of buttons, from the global heap and from an arena
+		auto buildScreen = [&](std::pmr::memory_resource* resource)
+		{
+			uie::ElementRegistry screen(resource);
+
+			for (std::size_t i = 0; i < elementCount; i++)
+				screen.create<uie::Button>(sf::FloatRect({}, ElementSize), "Button", CharacterSize, font);
+		};
+
+		report.results.push_back({ "screenHeap", time(std::max<std::size_t>(iterations / 10, 1), [&](std::size_t)
+		{
+			buildScreen(std::pmr::get_default_resource());
+		}) });
+
+		report.results.push_back({ "screenArena", time(std::max<std::size_t>(iterations / 10, 1), [&](std::size_t)
+		{
+			std::pmr::monotonic_buffer_resource arena;
+			buildScreen(&arena);
+		}) });
+
+		std::size_t allocations = allocationCount;
+		buildScreen(std::pmr::get_default_resource());
+		report.counters.push_back({ "allocationsPerScreenHeap", static_cast<double>(allocationCount - allocations) });
+
+		allocations = allocationCount;
+		{
+			std::pmr::monotonic_buffer_resource arena;
+			buildScreen(&arena);
+		}
+		report.counters.push_back({ "allocationsPerScreenArena", static_cast<double>(allocationCount - allocations) });
+
+		// Labelling every element with one of a few strings, as forms and toolbars do
+		const char* repeatedLabels[] = { "OK", "Cancel", "Apply", "Close" };
+		std::size_t layoutHits = uie::getTextLayoutHits();
+		std::size_t layoutMisses = uie::getTextLayoutMisses();
+
+		report.results.push_back({ "repeatedLabels", time(std::max<std::size_t>(iterations / 10, 1), [&](std::size_t)
+		{
+			std::vector<uie::Text> labels;
+			labels.reserve(elementCount);
+
+			for (std::size_t i = 0; i < elementCount; i++)
+				labels.emplace_back(sf::Vector2f(), repeatedLabels[i % 4], CharacterSize, font).getLocalBounds();
+		}) });
+
+		report.counters.push_back({ "textLayoutHits", static_cast<double>(uie::getTextLayoutHits() - layoutHits) });
+		report.counters.push_back({ "textLayoutMisses", static_cast<double>(uie::getTextLayoutMisses() - layoutMisses) });
+
+		return report;
+	}
+
+	void writeJson(std::ostream& out, const std::vector<ScaleReport>& reports, bool hasTexture)
+	{
+		out << "{\n";
+		out << "\t\"benchmark\": \"uie\",\n";
+		out << "\t\"renderTexture\": " << (hasTexture ? "true" : "false") << ",\n";
+		out << "\t\"scales\": [\n";
+
+		for (std::size_t i = 0; i < reports.size(); i++)
+		{
+			const ScaleReport& report = reports[i];
+
+			out << "\t\t{\n";
+			out << "\t\t\t\"elements\": " << report.elements << ",\n";
+			out << "\t\t\t\"results\": {\n";
+
+			for (std::size_t j = 0; j < report.results.size(); j++)
+			{
+				const Result& result = report.results[j];
+
+				out << "\t\t\t\t\"" << result.name << "\": ";
+
+				if (result.skipped.empty())
+					out << "{ \"iterations\": " << result.timing.iterations
+						<< ", \"meanNs\": " << result.timing.meanNs
+						<< ", \"minNs\": " << result.timing.minNs
+						<< ", \"maxNs\": " << result.timing.maxNs << " }";
+				else
+					out << "{ \"skipped\": \"" << result.skipped << "\" }";
+
+				out << (j + 1 < report.results.size() ? ",\n" : "\n");
+			}
+
+			out << "\t\t\t},\n";
+			out << "\t\t\t\"counters\": {\n";
+
+			for (std::size_t j = 0; j < report.counters.size(); j++)
+				out << "\t\t\t\t\"" << report.counters[j].first << "\": " << report.counters[j].second << (j + 1 < report.counters.size() ? ",\n" : "\n");
+
+			out << "\t\t\t}\n";
+			out << "\t\t}" << (i + 1 < reports.size() ? ",\n" : "\n");
+		}
+
+		out << "\t]\n";
+		out << "}\n";
+	}
+
+	std::vector<std::size_t> parseScales(const std::string& list)
+	{
+		std::vector<std::size_t> scales;
+		std::size_t start = 0;
+
+		while (start < list.size())
+		{
+			std::size_t end = list.find(',', start);
+
+			if (end == std::string::npos)
+				end = list.size();
+
+			scales.push_back(std::stoul(list.substr(start, end - start)));
+			start = end + 1;
+		}
+
+		return scales;
+	}
+} // namespace
+
+/**
+ * Usage: Benchmark [--font <path>] [--scales <n,n,...>] [--output <path>]
+ *
+ * The results are written as JSON to the output file, or to stdout if no file is given
+ */
+int main(int argc, char* argv[])
+{
+	std::string fontPath = "resource/arial.ttf";
+	std::string outputPath;
+	std::vector<std::size_t> scales{ 10, 1000, 100000 };
+
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		std::string option = argv[i];
+
+		if (option == "--font")
+			fontPath = argv[i + 1];
+		else if (option == "--scales")
+			scales = parseScales(argv[i + 1]);
+		else if (option == "--output")
+			outputPath = argv[i + 1];
+		else
+		{
+			std::cerr << "Unknown option " << option << '\n';
+			return EXIT_FAILURE;
+		}
+	}
+
+	sf::Font font;
+
+	if (!font.loadFromFile(fontPath))
+	{
+		std::cerr << "Could not load font " << fontPath << '\n';
+		return EXIT_FAILURE;
+	}
+
+	// Drawing is skipped instead of failing when there is no OpenGL context available
+	std::unique_ptr<sf::RenderTexture> texture = std::make_unique<sf::RenderTexture>();
+
+	if (!texture->create(TargetSize.x, TargetSize.y))
+		texture.reset();
+
+	std::vector<ScaleReport> reports;
+
+	for (std::size_t scale : scales)
+		reports.push_back(runScale(scale, font, texture.get()));
+
+	if (outputPath.empty())
+	{
+		writeJson(std::cout, reports, texture != nullptr);
+	}
+	else
+	{
+		std::ofstream file(outputPath);
+		writeJson(file, reports, texture != nullptr);
+	}
+
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -98,6 +98,100 @@ namespace sf
         ////////////////////////////////////////////////////////////
         void setCornerPointCount(unsigned int count);
 
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the number of points of each corner
+        ///
+        /// \return Number of points of each corner
+        ///
+        /// \see setCornerPointCount
+        ///
+        ////////////////////////////////////////////////////////////
+        unsigned int getCornerPointCount() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Set the thickness of the shape's outline
+        ///
+        /// Hides sf::Shape::setOutlineThickness, which always
+        /// rebuilds the geometry. When updates are deferred, the
+        /// rebuild is deferred as well.
+        ///
+        /// \param thickness New outline thickness
+        ///
+        /// \see sf::Shape::setOutlineThickness
+        ///
+        ////////////////////////////////////////////////////////////
+        void setOutlineThickness(float thickness);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Enable or disable deferred geometry updates
+        ///
+        /// When enabled, changing the size, radius or point count
+        /// does not rebuild the geometry immediately. The rebuild
+        /// happens once, on the next call to getLocalBounds,
+        /// getGlobalBounds or ensureUpdate. The shape must be
+        /// updated with ensureUpdate before it is drawn.
+        ///
+        /// Disabled by default.
+        ///
+        /// \param deferred True to defer the geometry updates
+        ///
+        /// \see isUpdateDeferred, ensureUpdate
+        ///
+        ////////////////////////////////////////////////////////////
+        void setUpdateDeferred(bool deferred);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether geometry updates are deferred
+        ///
+        /// \return True if the geometry updates are deferred
+        ///
+        /// \see setUpdateDeferred
+        ///
+        ////////////////////////////////////////////////////////////
+        bool isUpdateDeferred() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Rebuild the geometry if an update was deferred
+        ///
+        /// \see setUpdateDeferred
+        ///
+        ////////////////////////////////////////////////////////////
+        void ensureUpdate() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the local bounding rectangle of the entity
+        ///
+        /// Rebuilds the geometry first if an update was deferred.
+        ///
+        /// \return Local bounding rectangle of the entity
+        ///
+        /// \see sf::Shape::getLocalBounds
+        ///
+        ////////////////////////////////////////////////////////////
+        FloatRect getLocalBounds() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the global (non-minimal) bounding rectangle of the entity
+        ///
+        /// Rebuilds the geometry first if an update was deferred.
+        ///
+        /// \return Global bounding rectangle of the entity
+        ///
+        /// \see sf::Shape::getGlobalBounds
+        ///
+        ////////////////////////////////////////////////////////////
+        FloatRect getGlobalBounds() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the number of times any rounded rectangle rebuilt its geometry
+        ///
+        /// Rebuilds of a shape without points are not counted.
+        ///
+        /// \return Number of geometry rebuilds since the start of the program
+        ///
+        ////////////////////////////////////////////////////////////
+        static std::size_t getTessellationCount();
+
         ////////////////////////////////////////////////////////////
         /// \brief Get the number of points defining the rounded rectangle
         ///
@@ -120,11 +214,27 @@ namespace sf
 
     private:
         ////////////////////////////////////////////////////////////
+        /// \brief Update the geometry now or, if deferred, mark it as outdated
+        ///
+        ////////////////////////////////////////////////////////////
+        void requestUpdate();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Rebuild the geometry now
+        ///
+        ////////////////////////////////////////////////////////////
+        void tessellate();
+
+        ////////////////////////////////////////////////////////////
        // Member data
        ////////////////////////////////////////////////////////////
         Vector2f mySize;
         float myRadius;
         unsigned int myCornerPointCount;
+        const Vector2f* myCornerOffsets; ///< Shared unit circle offsets of all the points, see getCornerOffsets
+        bool myUpdateDeferred;           ///< Are geometry updates deferred?
+        mutable bool myNeedsUpdate;      ///< Is a deferred geometry update pending?
+        bool mySuspended;                ///< Report no points while emptying the geometry
     };
 }
 #endif // ROUNDEDRECTANGLESHAPE_HPP
@@ -2,6 +2,7 @@
 
 #include <SFML/Graphics.hpp>
 #include <UIElements.hpp>
+#include <memory_resource>
 
 using namespace uie;
 
@@ -10,14 +11,18 @@ class App
 private:
 	sf::RenderWindow window;
 	sf::Font font;
+	BatchRenderer renderer{ window };
 
-	RoundedRectangle r;
-	RoundedRectangle r2;
-	Text t;
-	Button b;
-	Checkbox cb;
-	Container<Text> c;
-	LineLayout<> l;
+	std::pmr::monotonic_buffer_resource arena;
+	ElementRegistry registry{ &arena };
+	Handle<RoundedRectangle> r;
+	Handle<RoundedRectangle> r2;
+	Handle<Text> t;
+	Handle<Button> b;
+	Handle<Checkbox> cb;
+	Handle<Container<Text>> c;
+	LineLayout<Handle<>> l;
+	EventDispatcher dispatcher{ l };
 
 	void run();
 	void handleEvents();
@@ -7,3 +7,13 @@
 #include <UIElements/Checkbox.hpp>
 #include <UIElements/Container.hpp>
 #include <UIElements/LineLayout.hpp>
+#include <UIElements/BatchRenderer.hpp>
+#include <UIElements/ElementRegistry.hpp>
+#include <UIElements/EventDispatcher.hpp>
+#include <UIElements/FontMetrics.hpp>
+#include <UIElements/InplaceFunction.hpp>
+#include <UIElements/RenderCache.hpp>
+#include <UIElements/SpatialIndex.hpp>
+#include <UIElements/StatsRenderTarget.hpp>
+#include <UIElements/Style.hpp>
+#include <UIElements/TextLayout.hpp>
@@ -0,0 +1,185 @@
+/*****************************************************************//**
+ * @file   BatchRenderer.hpp
+ * @brief  File containing the BatchRenderer class
+ *
+ * @author Bjorn Wakker
+ * @date   16 October 2026
+ *********************************************************************/
+#pragma once
+
+#include <UIElements/UIElement.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <vector>
+
+namespace uie
+{
+	/**
+	 * @brief Renderer which merges the geometry of ui-elements into as few draw calls as possible
+	 *
+	 * @details
+	 * Ui-elements append their already transformed triangles to the renderer,
+	 * the triangles are grouped per texture and only submitted to the render
+	 * target when flush is called
+	 *
+	 * Geometry is only merged into an earlier batch if it does not overlap
+	 * any batch that was added after it, this keeps the drawing order intact
+	 *
+	 * @see UIElement
+	 */
+	class BatchRenderer
+	{
+	private:
+		/**
+		 * @brief Structure holding the triangles of a single draw call
+		 */
+		struct Batch
+		{
+			const sf::Texture* texture = nullptr;
+			sf::FloatRect bounds;
+			std::vector<sf::Vertex> vertices;
+		};
+
+		sf::RenderTarget& target;			// The target to draw to
+		std::vector<Batch> batches;			// The batches, kept between frames to reuse their memory
+		std::size_t batchCount = 0;			// The number of batches in use
+		std::vector<sf::Vertex> scratch;	// Buffer for transforming the appended geometry
+		unsigned int lookBehind = 16;		// The number of batches to search for a matching texture
+
+		/**
+		 * @brief Check if geometry can be merged with the given render states
+		 *
+		 * @details Only the default blend mode without a shader can be merged
+		 *
+		 * @param[in] states The render states of the geometry
+		 *
+		 * @return True if the geometry can be batched, else false
+		 */
+		static bool canBatch(const sf::RenderStates& states);
+
+	protected:
+		/**
+		 * @brief Submit geometry to the render target
+		 *
+		 * @details Every draw call made by the renderer goes through here
+		 *
+		 * @param[in] vertices    The vertices to draw
+		 * @param[in] vertexCount The number of vertices
+		 * @param[in] type        The primitive type of the vertices
+		 * @param[in] states      The render states to use
+		 */
+		virtual void submit(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states);
+
+		/**
+		 * @brief Submit a drawable to the render target
+		 *
+		 * @param[in] drawable The object to draw
+		 * @param[in] states   The render states to use
+		 */
+		virtual void submit(const sf::Drawable& drawable, const sf::RenderStates& states);
+
+	public:
+		/**
+		 * @brief Overloaded constructor
+		 *
+		 * @param[in] target The render target to flush the batches to
+		 */
+		BatchRenderer(sf::RenderTarget& target);
+
+		/**
+		 * @brief Destructor
+		 *
+		 * @details Flushes the remaining batches
+		 */
+		virtual ~BatchRenderer();
+
+		/**
+		 * @brief Get the render target
+		 *
+		 * @return The render target the batches are flushed to
+		 */
+		sf::RenderTarget& getTarget() const;
+
+		/**
+		 * @brief Get the number of batches searched for a matching texture
+		 *
+		 * @return The number of batches
+		 *
+		 * @see setLookBehind
+		 */
+		unsigned int getLookBehind() const;
+
+		/**
+		 * @brief Set the number of batches searched for a matching texture
+		 *
+		 * @details
+		 * A higher number can result in less draw calls, but makes
+		 * appending geometry more expensive
+		 *
+		 * @param[in] count The number of batches
+		 *
+		 * @see getLookBehind
+		 */
+		void setLookBehind(unsigned int count);
+
+		/**
+		 * @brief Draw a ui-element using the renderer
+		 *
+		 * @details The ui-element appends its geometry using UIElement::batch
+		 *
+		 * @param[in] element The ui-element to draw
+		 * @param[in] states  The render states to use
+		 *
+		 * @see UIElement::batch
+		 */
+		virtual void draw(const UIElement& element, const sf::RenderStates& states = sf::RenderStates::Default);
+
+		/**
+		 * @brief Append geometry to the batches
+		 *
+		 * @details
+		 * The vertices are transformed using the transform of the render states
+		 * and their color is multiplied with the given color
+		 *
+		 * Only triangles, triangle strips and triangle fans can be batched,
+		 * other primitive types are drawn directly
+		 *
+		 * @param[in] vertices    The vertices to append
+		 * @param[in] vertexCount The number of vertices
+		 * @param[in] type        The primitive type of the vertices
+		 * @param[in] states      The render states of the geometry
+		 * @param[in] color       The color to multiply the vertices with
+		 */
+		virtual void append(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states, const sf::Color& color = sf::Color::White);
+
+		/**
+		 * @brief Draw a drawable without batching it
+		 *
+		 * @details The pending batches are flushed first to keep the drawing order intact
+		 *
+		 * @param[in] drawable The object to draw
+		 * @param[in] states   The render states to use
+		 */
+		void drawUnbatched(const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+		/**
+		 * @brief Draw all the pending batches to the render target
+		 */
+		void flush();
+	};
+} // namespace uie
+
+/**
+ * @class uie::BatchRenderer
+ *
+ * @details
+ * Usage Example:
+ * @code
+ * uie::BatchRenderer renderer(window);
+ *
+ * window.clear();
+ * renderer.draw(layout);
+ * renderer.flush();
+ * window.display();
+ * @endcode
+ */
\ No newline at end of file
@@ -10,7 +10,9 @@
 #include <UIElements/UIElement.hpp>
 #include <UIElements/RoundedRectangle.hpp>
 #include <UIElements/Text.hpp>
-#include <functional>
+#include <UIElements/InplaceFunction.hpp>
+#include <UIElements/Style.hpp>
+#include <cstdint>
 
 namespace uie
 {
@@ -37,7 +39,16 @@ namespace uie
 	private:
 		RoundedRectangle rectangle;    // The rectangle
 		Text text;                     // The text
-		std::function<void()> onClick; // The function to be executed on click
+		Callback onClick; // The function to be executed on click
+		const Style* style = nullptr;  // The shared style, nullptr if the button has none
+		std::uint64_t styleVersion = 0; // The version of the style which was last applied
+
+		/**
+		 * @brief Make the button the parent of its rectangle and text
+		 * 
+		 * @details The rectangle and text are positioned in the layout coordinates of the button
+		 */
+		void adoptChildren() const;
 
 	public:
 		/**
@@ -47,7 +58,7 @@ namespace uie
 		 */
 		struct Attributes
 		{
-			std::function<void()> onClick = [](){};
+			Callback onClick = [](){};
 			RoundedRectangle::Attributes rectangleAttributes{ .outlineThickness = 1.0f };
 			Text::Attributes textAttributes{};
 		};
@@ -57,7 +68,43 @@ namespace uie
 		 * 
 		 * @see Button
 		 */
-		Button() = default;
+		Button();
+
+		/**
+		 * @brief Copy constructor
+		 *
+		 * @details The rectangle and text of the copy belong to the copy
+		 *
+		 * @param[in] other The button to copy
+		 */
+		Button(const Button& other);
+
+		/**
+		 * @brief Move constructor
+		 *
+		 * @details The rectangle and text of the new button belong to the new button
+		 *
+		 * @param[in] other The button to move
+		 */
+		Button(Button&& other);
+
+		/**
+		 * @brief Copy assignment
+		 *
+		 * @param[in] other The button to copy
+		 *
+		 * @return A reference to this button
+		 */
+		Button& operator=(const Button& other) = default;
+
+		/**
+		 * @brief Move assignment
+		 *
+		 * @param[in] other The button to move
+		 *
+		 * @return A reference to this button
+		 */
+		Button& operator=(Button&& other) = default;
 
 		/**
 		 * @brief Overloaded constructor
@@ -168,7 +215,7 @@ namespace uie
 		 * 
 		 * @see setRectange
 		 */
-		RoundedRectangle& const getRectangle();
+		RoundedRectangle& getRectangle();
 
 		/**
 		 * @brief Set the button rectangle
@@ -186,7 +233,7 @@ namespace uie
 		 * 
 		 * @see setText
 		 */
-		Text& const getText();
+		Text& getText();
 
 		/**
 		 * @brief Set the button text
@@ -206,18 +253,23 @@ namespace uie
 		 * 
 		 * @see setOnClick
 		 */
-		const std::function<void()>& getOnClick() const;
+		const Callback& getOnClick() const;
 		
 		/**
 		 * @brief Set the onClick function
 		 * 
-		 * @details Set the function to be executed on click
+		 * @details
+		 * Set the function to be executed on click
+		 * 
+		 * The function is stored inside the button, so copying the button never
+		 * allocates for it, its captures may not be larger than eight pointers
+		 * A std::function always fits, larger captures are a compile error
 		 * 
 		 * @param[in] functor A reference to the new onClick function
 		 * 
 		 * @see getOnClick
 		 */
-		void setOnClick(const std::function<void()>& functor);
+		void setOnClick(const Callback& functor);
 		
 		/**
 		 * @brief Executes the onClick function
@@ -228,6 +280,28 @@ namespace uie
 		 */
 		void executeOnClick();
 
+		/**
+		 * @brief Get the style
+		 * 
+		 * @return The style the button uses, or nullptr if it has none
+		 * 
+		 * @see setStyle
+		 */
+		const Style* getStyle() const;
+		
+		/**
+		 * @brief Set the style
+		 * 
+		 * @details
+		 * The attributes of the style are applied to the rectangle and text right away,
+		 * and again whenever the style changes
+		 * 
+		 * @param[in] style The style to use, it must outlive the button, or nullptr to stop using a style
+		 * 
+		 * @see getStyle, Style
+		 */
+		void setStyle(const Style* style);
+
 		/**
 		 * @brief Get the local boundaries
 		 *
@@ -323,6 +397,34 @@ namespace uie
 		 */
 		void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
+		/**
+		 * @brief Append the button to a batch renderer
+		 *
+		 * @param[in] renderer Batch renderer to append to
+		 * @param[in] states   Current render states
+		 * 
+		 * @see BatchRenderer
+		 */
+		void batch(BatchRenderer& renderer, sf::RenderStates states) const override;
+
+		/**
+		 * @brief Handle a click on the button
+		 *
+		 * @details Executes the onClick function when clicked with the left mouse button
+		 *
+		 * @param[in] button The clicked mouse button
+		 *
+		 * @see executeOnClick, EventDispatcher
+		 */
+		void clicked(sf::Mouse::Button button) override;
+
+		/**
+		 * @brief Apply the style if it changed since it was last applied
+		 *
+		 * @see setStyle, Style
+		 */
+		void applyStyles() override;
+
 		/**
 		 * @brief Corrects the position of the text
 		 * 
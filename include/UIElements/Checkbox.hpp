@@ -11,6 +11,8 @@
 #include <UIElements/RoundedRectangle.hpp>
 #include <UIElements/Text.hpp>
 #include <UIElements/Alignment.hpp>
+#include <UIElements/Style.hpp>
+#include <cstdint>
 
 namespace uie
 {
@@ -38,6 +40,8 @@ namespace uie
 		sf::Color deselectedColor = sf::Color::Transparent;	// The color of the checkbox when it is not selected
 		unsigned int textDistance = 20;						// The distance between the text and the rectangle
 		Alignment alignment = Left;							// The positioning of the text relative to the rectangle
+		const Style* style = nullptr;						// The shared style, nullptr if the checkbox has none
+		std::uint64_t styleVersion = 0;						// The version of the style which was last applied
 
 		/**
 		 * @brief Checks if the allignment is possible for this ui-element
@@ -48,6 +52,13 @@ namespace uie
 		 */
 		void checkAlignment();
 
+		/**
+		 * @brief Make the checkbox the parent of its rectangle and text
+		 * 
+		 * @details The rectangle and text are positioned in the layout coordinates of the checkbox
+		 */
+		void adoptChildren() const;
+
 	public:
 		/**
 		 * @brief Structure for additional attributes
@@ -70,7 +81,43 @@ namespace uie
 		 * 
 		 * @see Checkbox
 		 */
-		Checkbox() = default;
+		Checkbox();
+
+		/**
+		 * @brief Copy constructor
+		 *
+		 * @details The rectangle and text of the copy belong to the copy
+		 *
+		 * @param[in] other The checkbox to copy
+		 */
+		Checkbox(const Checkbox& other);
+
+		/**
+		 * @brief Move constructor
+		 *
+		 * @details The rectangle and text of the new checkbox belong to the new checkbox
+		 *
+		 * @param[in] other The checkbox to move
+		 */
+		Checkbox(Checkbox&& other);
+
+		/**
+		 * @brief Copy assignment
+		 *
+		 * @param[in] other The checkbox to copy
+		 *
+		 * @return A reference to this checkbox
+		 */
+		Checkbox& operator=(const Checkbox& other) = default;
+
+		/**
+		 * @brief Move assignment
+		 *
+		 * @param[in] other The checkbox to move
+		 *
+		 * @return A reference to this checkbox
+		 */
+		Checkbox& operator=(Checkbox&& other) = default;
 
 		/**
 		 * @brief Overloaded constructor
@@ -181,7 +228,7 @@ namespace uie
 		 *
 		 * @see setRectange
 		 */
-		RoundedRectangle& const getRectangle();
+		RoundedRectangle& getRectangle();
 		
 		/**
 		 * @brief Set the checkbox rectangle
@@ -199,7 +246,7 @@ namespace uie
 		 *
 		 * @see setText
 		 */
-		Text& const getText();
+		Text& getText();
 		
 		/**
 		 * @brief Set the checkbox text
@@ -234,6 +281,29 @@ namespace uie
 		 */
 		void toggle();
 
+		/**
+		 * @brief Get the style
+		 * 
+		 * @return The style the checkbox uses, or nullptr if it has none
+		 * 
+		 * @see setStyle
+		 */
+		const Style* getStyle() const;
+		
+		/**
+		 * @brief Set the style
+		 * 
+		 * @details
+		 * The attributes of the style are applied to the rectangle and text right away,
+		 * and again whenever the style changes
+		 * The fill color of the rectangle keeps following the selected and deselected color
+		 * 
+		 * @param[in] style The style to use, it must outlive the checkbox, or nullptr to stop using a style
+		 * 
+		 * @see getStyle, Style
+		 */
+		void setStyle(const Style* style);
+
 		/*------------------------------*/
 		/*   Interface implementations  */
 		/*------------------------------*/
@@ -248,6 +318,9 @@ namespace uie
 		bool intersects(const sf::Vector2f& point) const override;
 		bool intersects(const sf::FloatRect& rect) const override;
 		void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void batch(BatchRenderer& renderer, sf::RenderStates states) const override;
+		void clicked(sf::Mouse::Button button) override;
+		void applyStyles() override;
 
 		/*------------------------------*/
 		/*            Visual            */
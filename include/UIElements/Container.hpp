@@ -4,6 +4,8 @@
 #include <UIElements/RoundedRectangle.hpp>
 #include <UIElements/Alignment.hpp>
 #include <UIElements/ExtraFunctions.hpp>
+#include <UIElements/BatchRenderer.hpp>
+#include <UIElements/RenderCache.hpp>
 #include <unordered_map>
 #include <format>
 
@@ -14,13 +16,16 @@ namespace uie
 	{
 	private:
 		RoundedRectangle container;
-		T content;
+		T content{};
 		sf::Vector2f originalPosition;
 		sf::Vector2f originalSize;
 		sf::Vector2f drawPosition;
 		sf::Vector2f drawSize;
 		Alignment alignment = Center;
 		bool overlapOutline = false;
+		mutable RenderCache cache;
+		sf::Vector2f offset;
+		mutable unsigned int visibleElementCount = 0;
 
 		bool checkAlignment()
 		{
@@ -30,6 +35,89 @@ namespace uie
 				throw std::runtime_error(std::format("Container with content of type '{}' does not support alignment '{}'", type, toString(alignment)));
 		}
 
+		void adoptChildren() const
+		{
+			container.setParent(this);
+
+			if (isValid(content))
+				ptr(content)->setParent(this);
+		}
+
+		void clearPaintDirty() const
+		{
+			container.clearDirty(PaintDirty);
+
+			if (isValid(content))
+				ptr(content)->clearDirty(PaintDirty);
+
+			clearDirty(PaintDirty);
+		}
+
+		void batchContent(BatchRenderer& renderer, sf::RenderStates states) const
+		{
+			sf::FloatRect visibleArea = getVisibleArea(renderer.getTarget(), states.transform);
+			visibleElementCount = 0;
+
+			if (container.getCachedLayoutBounds().intersects(visibleArea))
+				renderer.draw(container, states);
+
+			if (ptr(content)->getCachedLayoutBounds().intersects(visibleArea))
+			{
+				renderer.draw(*ptr(content), states);
+				visibleElementCount++;
+			}
+		}
+
+		bool updateCache() const
+		{
+			if (!cache.isEnabled())
+				return false;
+
+			sf::FloatRect bounds = container.getLayoutBounds();
+
+			if (cache.needsUpdate(bounds) || isPaintDirty())
+			{
+				sf::RenderTarget* cacheTarget = cache.begin(bounds);
+
+				if (!cacheTarget)
+					return false;
+
+				BatchRenderer renderer(*cacheTarget);
+				batchContent(renderer, sf::RenderStates::Default);
+				renderer.flush();
+				cache.end();
+			}
+
+			return true;
+		}
+
+	protected:
+		sf::Vector2f getContentOffset() const override
+		{
+			return offset;
+		}
+
+		sf::Vector2f measureOverride(const sf::Vector2f&) override
+		{
+			// The container keeps its size, the content only has to be measured for the arrangement
+			adoptChildren();
+			ptr(content)->measure(container.getSize());
+			return getCachedLayoutBounds().getSize();
+		}
+
+		void arrangeOverride(const sf::FloatRect& rect) override
+		{
+			sf::FloatRect bounds = getCachedLayoutBounds();
+
+			if (rect.getPosition() != bounds.getPosition())
+				move(rect.getPosition() - bounds.getPosition());
+
+			if (rect.getSize() != bounds.getSize())
+				container.setSize(getSize() + rect.getSize() - bounds.getSize());
+
+			correctContentPosition();
+		}
+
 	public:
 		struct Attributes
 		{
@@ -42,13 +130,17 @@ namespace uie
 		/*          Functional          */
 		/*------------------------------*/
 
-		Container() = default;
+		Container()
+		{
+			adoptChildren();
+		}
 
 		Container(const sf::Vector2f& position, const sf::Vector2f& size)
 		{
 			container = RoundedRectangle(position, size);
 			container.setFillColor(sf::Color::Color::Transparent);
 			container.makeRectangle();
+			adoptChildren();
 		}
 
 		Container(const sf::Vector2f& position, const sf::Vector2f& size, const Attributes& attributes)
@@ -95,35 +187,133 @@ namespace uie
 
 		}
 
+		Container(const sf::Vector2f& position, const sf::Vector2f& size, T&& content)
+			: Container(position, size)
+		{
+			this->content = std::move(content);
+			correctContentPosition();
+		}
+
+		Container(const sf::Vector2f& position, const sf::Vector2f& size, const Attributes& attributes, T&& content)
+			: Container(position, size, attributes)
+		{
+			this->content = std::move(content);
+			correctContentPosition();
+		}
+
+		Container(const sf::FloatRect& rect, T&& content)
+			: Container(rect.getPosition(), rect.getSize(), std::move(content))
+		{
+
+		}
+
+		Container(const sf::FloatRect& rect, const Attributes& attributes, T&& content)
+			: Container(rect.getPosition(), rect.getSize(), attributes, std::move(content))
+		{
+
+		}
+
+		Container(const Container& other)
+			: UIElement(other), container(other.container), content(other.content), originalPosition(other.originalPosition), originalSize(other.originalSize),
+			drawPosition(other.drawPosition), drawSize(other.drawSize), alignment(other.alignment), overlapOutline(other.overlapOutline), cache(other.cache), offset(other.offset)
+		{
+			adoptChildren();
+		}
+
+		Container(Container&& other)
+			: UIElement(std::move(other)), container(std::move(other.container)), content(std::move(other.content)), originalPosition(other.originalPosition), originalSize(other.originalSize),
+			drawPosition(other.drawPosition), drawSize(other.drawSize), alignment(other.alignment), overlapOutline(other.overlapOutline), cache(std::move(other.cache)), offset(other.offset)
+		{
+			adoptChildren();
+		}
+
+		~Container()
+		{
+			// Pointer content outlives the container, so it should not keep referring to it
+			if (isValid(content) && ptr(content)->getParent() == this)
+				ptr(content)->setParent(nullptr);
+		}
+
+		Container& operator=(const Container& other)
+		{
+			UIElement::operator=(other);
+			container = other.container;
+			content = other.content;
+			originalPosition = other.originalPosition;
+			originalSize = other.originalSize;
+			drawPosition = other.drawPosition;
+			drawSize = other.drawSize;
+			alignment = other.alignment;
+			overlapOutline = other.overlapOutline;
+			cache = other.cache;
+			offset = other.offset;
+			adoptChildren();
+			return *this;
+		}
+
+		Container& operator=(Container&& other)
+		{
+			UIElement::operator=(std::move(other));
+			container = std::move(other.container);
+			content = std::move(other.content);
+			originalPosition = other.originalPosition;
+			originalSize = other.originalSize;
+			drawPosition = other.drawPosition;
+			drawSize = other.drawSize;
+			alignment = other.alignment;
+			overlapOutline = other.overlapOutline;
+			cache = std::move(other.cache);
+			offset = other.offset;
+			adoptChildren();
+			return *this;
+		}
+
 		void setAttributes(const Attributes& attributes)
 		{
 			alignment = attributes.contentAlignment;
 			overlapOutline = attributes.overlapOutline;
 			container.setAttributes(attributes.containerAttributes);
+			cache.invalidate();
+			markDirty();
 		}
 
-		RoundedRectangle& const getContainer()
+		RoundedRectangle& getContainer()
 		{
+			container.setParent(this);
 			return container;
 		}
 
 		void setContainer(const RoundedRectangle& container)
 		{
+			// Keep the global position of the container, it is drawn at the offset of the container ui-element
 			this->container = container;
+			this->container.setPosition(container.getPosition());
 			correctContentPosition();
 		}
 
 		T& getContent()
 		{
+			adoptChildren();
 			return content;
 		}
 
+		unsigned int getVisibleElementCount() const
+		{
+			return visibleElementCount;
+		}
+
 		void setContent(const T& content)
 		{
 			this->content = content;
 			correctContentPosition();
 		}
 
+		void setContent(T&& content)
+		{
+			this->content = std::move(content);
+			correctContentPosition();
+		}
+
 		/*------------------------------*/
 		/*   Interface implementations  */
 		/*------------------------------*/
@@ -133,6 +323,7 @@ namespace uie
 			return container.getLocalBounds();
 		}
 
+		// The container rectangle is a child, so it includes the offset of this container and of its parents
 		sf::FloatRect getGlobalBounds() const override
 		{
 			return container.getGlobalBounds();
@@ -145,8 +336,7 @@ namespace uie
 
 		void setPosition(const sf::Vector2f& position) override
 		{
-			container.setPosition(position);
-			correctContentPosition();
+			move(position - getPosition());
 		}
 
 		sf::Vector2f getSize() const override
@@ -162,8 +352,14 @@ namespace uie
 
 		void move(const sf::Vector2f& offset) override
 		{
-			container.move(offset);
-			ptr(content)->move(offset);
+			// The content is drawn relative to the offset, so moving does not change its layout
+			bool layoutDirty = isLayoutDirty();
+
+			this->offset += offset;
+			markDirty();
+
+			if (!layoutDirty)
+				clearDirty(LayoutDirty);
 		}
 
 		bool intersects(const sf::Vector2f& point) const override
@@ -176,16 +372,86 @@ namespace uie
 			return container.intersects(rect);
 		}
 
+		using UIElement::hitTest;
+
+		UIElement* hitTest(const sf::Vector2f& point, sf::Vector2f* localPoint = nullptr) override
+		{
+			if (!intersects(point + getParentOffset()))
+				return nullptr;
+
+			// The content is in the coordinates of the container, without the offset
+			if (UIElement* hit = ptr(content)->hitTest(point - offset, localPoint))
+				return hit;
+
+			if (localPoint)
+				*localPoint = point;
+
+			return this;
+		}
+
 		void draw(sf::RenderTarget& target, sf::RenderStates states) const override
 		{
-			target.draw(container, states);
-			ptr(content)->draw(target, states);
+			states.transform.translate(offset);
+
+			if (updateCache())
+			{
+				cache.draw(target, states, container.getLayoutBounds().getPosition());
+				clearPaintDirty();
+				return;
+			}
+
+			sf::FloatRect visibleArea = getVisibleArea(target, states.transform);
+			visibleElementCount = 0;
+
+			if (container.getCachedLayoutBounds().intersects(visibleArea))
+				target.draw(container, states);
+
+			if (ptr(content)->getCachedLayoutBounds().intersects(visibleArea))
+			{
+				ptr(content)->draw(target, states);
+				visibleElementCount++;
+			}
+
+			clearPaintDirty();
+		}
+
+		void batch(BatchRenderer& renderer, sf::RenderStates states) const override
+		{
+			states.transform.translate(offset);
+
+			if (updateCache())
+				cache.batch(renderer, states, container.getLayoutBounds().getPosition());
+			else
+				batchContent(renderer, states);
+
+			clearPaintDirty();
+		}
+
+		void applyStyles() override
+		{
+			if (isValid(content))
+				ptr(content)->applyStyles();
 		}
 
 		/*------------------------------*/
 		/*            Visual            */
 		/*------------------------------*/
 
+		bool isCachedToTexture() const
+		{
+			return cache.isEnabled();
+		}
+
+		void cacheToTexture(bool cached = true)
+		{
+			cache.setEnabled(cached);
+		}
+
+		void invalidateCache()
+		{
+			cache.invalidate();
+		}
+
 		Alignment getContentAlignment() const
 		{
 			return alignment;
@@ -211,10 +477,10 @@ namespace uie
 		void correctContentPosition()
 		{
 			checkAlignment();
+			adoptChildren();
 
-			sf::FloatRect contentBounds = ptr(content)->getGlobalBounds();
-			sf::Vector2f currentPosition = contentBounds.getPosition();
-			sf::Vector2f currentSize = contentBounds.getSize();
+			sf::Vector2f currentPosition = ptr(content)->getCachedLayoutBounds().getPosition();
+			sf::Vector2f currentSize = ptr(content)->measure(container.getSize());
 
 			if (currentPosition != drawPosition || currentSize != drawSize)
 			{
@@ -222,7 +488,7 @@ namespace uie
 				originalSize = currentSize;
 			}
 
-			sf::FloatRect containerBounds = container.getGlobalBounds();
+			sf::FloatRect containerBounds = container.getCachedLayoutBounds();
 			float containerOutlineThickness = overlapOutline ? 0 : container.getOutlineThickness();
 
 			drawSize = originalSize;
@@ -270,24 +536,19 @@ namespace uie
 				drawSize = originalSize;
 			}
 
-			// May not really work that well anymore
 			if ((alignment & Stretch) != 0)
 			{
-				drawPosition = overlapOutline ? containerBounds.getPosition() : getPosition();
+				drawPosition = overlapOutline ? containerBounds.getPosition() : container.getLayoutPosition();
 				drawSize = overlapOutline ? containerBounds.getSize() : getSize();
 			}
 
-			Any pContent = ptr(content);
+			ptr(content)->arrange({ drawPosition, drawSize });
 
-			sf::Vector2f oldPos = pContent->getPosition();
-			sf::Vector2f newPos = drawPosition - (currentPosition - oldPos);
-			if (newPos != oldPos)
-				pContent->setPosition(newPos);
+			cache.invalidate();
 
-			sf::Vector2f oldSize = pContent->getSize();
-			sf::Vector2f newSize = drawSize - (currentSize - oldSize);
-			if (newSize != oldSize)
-				pContent->setSize(newSize);
+			container.clearDirty(LayoutDirty);
+			ptr(content)->clearDirty(LayoutDirty);
+			clearDirty(LayoutDirty);
 		}
 	};
 } // namespace uie
@@ -0,0 +1,562 @@
+/*****************************************************************//**
+ * @file   ElementRegistry.hpp
+ * @brief  File containing the ElementRegistry and Handle classes
+ *
+ * @author Bjorn Wakker
+ * @date   16 October 2026
+ *********************************************************************/
+#pragma once
+
+#include <UIElements/UIElement.hpp>
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+
+namespace uie
+{
+	class ElementRegistry;
+
+	namespace detail
+	{
+		/**
+		 * @brief Type independent part of a pool, so handles of a base type can resolve any pool
+		 */
+		class PoolBase
+		{
+		public:
+			virtual ~PoolBase() = default;
+
+			/**
+			 * @brief Get the ui-element in a slot
+			 *
+			 * @param[in] index      The index of the slot
+			 * @param[in] generation The generation the slot must still have
+			 *
+			 * @return The ui-element, or nullptr if the slot was destroyed since
+			 */
+			virtual UIElement* get(std::uint32_t index, std::uint32_t generation) const = 0;
+
+			/**
+			 * @brief Destroy the ui-element in a slot
+			 *
+			 * @param[in] index      The index of the slot
+			 * @param[in] generation The generation the slot must still have
+			 *
+			 * @return True if the ui-element was destroyed, false if it already was
+			 */
+			virtual bool destroy(std::uint32_t index, std::uint32_t generation) = 0;
+
+			/**
+			 * @brief Destroy all ui-elements, keeping the memory
+			 */
+			virtual void clear() = 0;
+		};
+
+		/**
+		 * @brief Deleter for pools allocated from a memory resource
+		 */
+		struct PoolDeleter
+		{
+			void (*function)(std::pmr::memory_resource*, PoolBase*) = nullptr;
+			std::pmr::memory_resource* resource = nullptr;
+
+			void operator()(PoolBase* pool) const
+			{
+				function(resource, pool);
+			}
+		};
+
+		/**
+		 * @brief Storage of all ui-elements of a single type
+		 *
+		 * @details
+		 * The slots are stored in fixed size chunks, which are contiguous
+		 * but never move, so pointers to ui-elements in the pool stay valid
+		 *
+		 * All memory of the pool comes from its memory resource, ui-elements
+		 * which are allocator-aware are constructed with it as well
+		 */
+		template <typename T>
+		class Pool : public PoolBase
+		{
+		private:
+			struct Slot
+			{
+				alignas(T) std::byte storage[sizeof(T)];
+				bool used = false;
+				std::uint32_t generation = 1;	// Starts at 1, so a default handle never matches
+
+				T* element()
+				{
+					return std::launder(reinterpret_cast<T*>(storage));
+				}
+			};
+
+			static constexpr std::uint32_t ChunkSize = 256;
+
+			std::pmr::polymorphic_allocator<> allocator;
+			std::pmr::vector<Slot*> chunks;
+			std::pmr::vector<std::uint32_t> freeSlots;
+			std::uint32_t slotCount = 0;
+			std::size_t elementCount = 0;
+
+			Slot& getSlot(std::uint32_t index) const
+			{
+				return chunks[index / ChunkSize][index % ChunkSize];
+			}
+
+			template <typename... Args>
+			void construct(Slot& slot, Args&&... args)
+			{
+				std::uninitialized_construct_using_allocator(slot.element(), allocator, std::forward<Args>(args)...);
+				slot.used = true;
+			}
+
+		public:
+			Pool(std::pmr::memory_resource* resource)
+				: allocator(resource), chunks(resource), freeSlots(resource)
+			{
+
+			}
+
+			Pool(const Pool&) = delete;
+			Pool& operator=(const Pool&) = delete;
+
+			~Pool()
+			{
+				clear();
+
+				for (Slot* chunk : chunks)
+					allocator.deallocate_object(chunk, ChunkSize);
+			}
+
+			UIElement* get(std::uint32_t index, std::uint32_t generation) const override
+			{
+				return find(index, generation);
+			}
+
+			T* find(std::uint32_t index, std::uint32_t generation) const
+			{
+				if (index >= slotCount)
+					return nullptr;
+
+				Slot& slot = getSlot(index);
+				return slot.generation == generation && slot.used ? slot.element() : nullptr;
+			}
+
+			template <typename... Args>
+			std::pair<std::uint32_t, std::uint32_t> create(Args&&... args)
+			{
+				std::uint32_t index;
+
+				// Reuse destroyed slots first, so the pool stays dense
+				if (!freeSlots.empty())
+				{
+					index = freeSlots.back();
+					construct(getSlot(index), std::forward<Args>(args)...);
+					freeSlots.pop_back();
+				}
+				else
+				{
+					if (slotCount % ChunkSize == 0)
+					{
+						chunks.reserve(chunks.size() + 1);
+						chunks.push_back(allocator.allocate_object<Slot>(ChunkSize));
+						std::uninitialized_default_construct_n(chunks.back(), ChunkSize);
+					}
+
+					construct(getSlot(slotCount), std::forward<Args>(args)...);
+					index = slotCount++;
+				}
+
+				elementCount++;
+				return { index, getSlot(index).generation };
+			}
+
+			bool destroy(std::uint32_t index, std::uint32_t generation) override
+			{
+				if (!find(index, generation))
+					return false;
+
+				Slot& slot = getSlot(index);
+				std::destroy_at(slot.element());
+				slot.used = false;
+				slot.generation++;
+				freeSlots.push_back(index);
+				elementCount--;
+
+				return true;
+			}
+
+			void clear() override
+			{
+				for (std::uint32_t index = 0; index < slotCount; index++)
+					if (Slot& slot = getSlot(index); slot.used)
+						destroy(index, slot.generation);
+			}
+
+			template <typename F>
+			void forEach(F&& function) const
+			{
+				for (std::uint32_t index = 0; index < slotCount; index++)
+					if (Slot& slot = getSlot(index); slot.used)
+						function(*slot.element());
+			}
+
+			std::size_t size() const
+			{
+				return elementCount;
+			}
+		};
+	} // namespace detail
+
+	/**
+	 * @brief Generational reference to a ui-element owned by an ElementRegistry
+	 *
+	 * @details
+	 * A handle stays the same size and can be copied freely, like a pointer,
+	 * but once the ui-element is destroyed the handle no longer resolves,
+	 * even if its slot is reused by a new ui-element
+	 *
+	 * A handle converts to a handle of any base type, Handle<> refers to any ui-element
+	 *
+	 * A handle refers to the pool of its registry, it must not outlive the registry,
+	 * not even to check if it is valid
+	 *
+	 * @tparam T The type of the ui-element
+	 *
+	 * @see ElementRegistry
+	 */
+	template <typename T = UIElement>
+	class Handle
+	{
+	private:
+		template <typename U>
+		friend class Handle;
+		friend class ElementRegistry;
+
+		detail::PoolBase* pool = nullptr;	// The pool owning the ui-element
+		std::uint32_t index = 0;			// The slot of the ui-element in the pool
+		std::uint32_t generation = 0;		// The generation of the slot when the ui-element was created
+
+		Handle(detail::PoolBase* pool, std::uint32_t index, std::uint32_t generation)
+			: pool(pool), index(index), generation(generation)
+		{
+
+		}
+
+	public:
+		using ElementType = T;
+
+		Handle() = default;
+
+		template <typename U>
+			requires std::is_base_of_v<T, U>
+		Handle(const Handle<U>& other)
+			: pool(other.pool), index(other.index), generation(other.generation)
+		{
+
+		}
+
+		/**
+		 * @brief Get the ui-element
+		 *
+		 * @return The ui-element, or nullptr if the handle is empty or stale
+		 */
+		T* get() const
+		{
+			return pool ? static_cast<T*>(pool->get(index, generation)) : nullptr;
+		}
+
+		/**
+		 * @brief Check if the handle still refers to a ui-element
+		 *
+		 * @return True if the ui-element exists, else false
+		 */
+		bool isValid() const
+		{
+			return get();
+		}
+
+		/**
+		 * @brief Get the ui-element, a stale handle is an error
+		 *
+		 * @return The ui-element
+		 */
+		T* operator->() const
+		{
+			if (T* element = get())
+				return element;
+
+			throw std::logic_error("The handle does not refer to an existing ui-element");
+		}
+
+		T& operator*() const
+		{
+			return *operator->();
+		}
+
+		explicit operator bool() const
+		{
+			return isValid();
+		}
+
+		template <typename U>
+		bool operator==(const Handle<U>& other) const
+		{
+			return pool == other.pool && index == other.index && generation == other.generation;
+		}
+	};
+
+	/**
+	 * @brief Get the ui-element a handle refers to
+	 *
+	 * @details Lets layouts store handles the same way as references and pointers
+	 *
+	 * @tparam T The type of the ui-element
+	 *
+	 * @param[in] handle The handle of the ui-element
+	 *
+	 * @return A pointer to the ui-element
+	 *
+	 * @see ptr
+	 */
+	template <typename T>
+	T* ptr(const Handle<T>& handle)
+	{
+		return handle.operator->();
+	}
+
+	/**
+	 * @see ptr(const Handle<T>&)
+	 */
+	template <typename T>
+	T* ptr(Handle<T>& handle)
+	{
+		return handle.operator->();
+	}
+
+	/**
+	 * @brief Check if a handle still refers to a ui-element
+	 *
+	 * @see isValid
+	 */
+	template <typename T>
+	bool isValid(const Handle<T>& handle)
+	{
+		return handle.isValid();
+	}
+
+	/**
+	 * @brief Owner of ui-elements, stored in a pool per type
+	 *
+	 * @details
+	 * Ui-elements of the same type are stored next to each other, instead
+	 * of spread over the heap, and are referred to by generational handles
+	 *
+	 * Layouts can store handles instead of pointers, using a stale handle
+	 * throws instead of reading a destroyed ui-element
+	 *
+	 * The registry must outlive its handles, including the handles stored
+	 * in layouts which are not created in the registry
+	 *
+	 * All memory of the registry comes from a memory resource, so a screen can
+	 * be built in a std::pmr::monotonic_buffer_resource and released at once
+	 * Buffers owned by SFML, such as the strings and vertices of sf::Text,
+	 * are not allocator-aware and still come from the global heap
+	 *
+	 * @see Handle
+	 */
+	class ElementRegistry
+	{
+	private:
+		std::pmr::memory_resource* resource;	// The memory resource of the pools
+		std::pmr::unordered_map<std::type_index, std::unique_ptr<detail::PoolBase, detail::PoolDeleter>> pools;
+
+		template <typename T>
+		detail::Pool<T>* findPool() const
+		{
+			auto pool = pools.find(typeid(T));
+			return pool != pools.end() ? static_cast<detail::Pool<T>*>(pool->second.get()) : nullptr;
+		}
+
+		template <typename T>
+		detail::Pool<T>& getPool()
+		{
+			auto& pool = pools[typeid(T)];
+
+			if (!pool)
+			{
+				auto deleter = [](std::pmr::memory_resource* resource, detail::PoolBase* pool)
+				{
+					std::pmr::polymorphic_allocator<>(resource).delete_object(static_cast<detail::Pool<T>*>(pool));
+				};
+
+				pool = { std::pmr::polymorphic_allocator<>(resource).new_object<detail::Pool<T>>(resource), { deleter, resource } };
+			}
+
+			return static_cast<detail::Pool<T>&>(*pool);
+		}
+
+	public:
+		/**
+		 * @brief Overloaded constructor
+		 *
+		 * @param[in] resource The memory resource the ui-elements are stored in, it must outlive the registry
+		 */
+		ElementRegistry(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+			: resource(resource), pools(resource)
+		{
+
+		}
+
+		/**
+		 * @brief Destructor
+		 *
+		 * @details
+		 * Destroys all ui-elements before freeing any pool, so layouts of handles
+		 * created in the registry never resolve their handles in a freed pool
+		 */
+		~ElementRegistry()
+		{
+			clear();
+		}
+
+		ElementRegistry(const ElementRegistry&) = delete;
+		ElementRegistry(ElementRegistry&&) = default;
+
+		ElementRegistry& operator=(const ElementRegistry&) = delete;
+		ElementRegistry& operator=(ElementRegistry&&) = delete;
+
+		/**
+		 * @brief Get the memory resource
+		 *
+		 * @return The memory resource the ui-elements are stored in
+		 */
+		std::pmr::memory_resource* getResource() const
+		{
+			return resource;
+		}
+
+		/**
+		 * @brief Create a ui-element
+		 *
+		 * @tparam T The type of the ui-element
+		 *
+		 * @param[in] args The arguments passed to the constructor of the ui-element
+		 *
+		 * @return The handle of the ui-element
+		 */
+		template <typename T, typename... Args>
+			requires std::is_base_of_v<UIElement, T>
+		Handle<T> create(Args&&... args)
+		{
+			detail::Pool<T>& pool = getPool<T>();
+			auto [index, generation] = pool.create(std::forward<Args>(args)...);
+
+			return Handle<T>(&pool, index, generation);
+		}
+
+		/**
+		 * @brief Destroy a ui-element
+		 *
+		 * @details All handles of the ui-element become stale
+		 *
+		 * @param[in] handle The handle of the ui-element
+		 *
+		 * @return True if the ui-element was destroyed, false if the handle was already stale
+		 */
+		template <typename T>
+		bool destroy(const Handle<T>& handle)
+		{
+			if (!handle.isValid())
+				return false;
+
+			// The handle may be of a base type, so destroy through the pool it refers to
+			auto pool = std::find_if(pools.begin(), pools.end(), [&](const auto& pool) { return pool.second.get() == handle.pool; });
+
+			if (pool == pools.end())
+				return false;
+
+			return pool->second->destroy(handle.index, handle.generation);
+		}
+
+		/**
+		 * @brief Get a ui-element
+		 *
+		 * @param[in] handle The handle of the ui-element
+		 *
+		 * @return The ui-element, or nullptr if the handle is stale
+		 */
+		template <typename T>
+		T* get(const Handle<T>& handle) const
+		{
+			return handle.get();
+		}
+
+		/**
+		 * @brief Get the number of ui-elements of a type
+		 *
+		 * @tparam T The type of the ui-elements
+		 *
+		 * @return The number of ui-elements
+		 */
+		template <typename T>
+		std::size_t size() const
+		{
+			const detail::Pool<T>* pool = findPool<T>();
+			return pool ? pool->size() : 0;
+		}
+
+		/**
+		 * @brief Call a function for every ui-element of a type, in storage order
+		 *
+		 * @tparam T The type of the ui-elements
+		 *
+		 * @param[in] function The function taking a reference to the ui-element
+		 */
+		template <typename T, typename F>
+		void forEach(F&& function) const
+		{
+			if (const detail::Pool<T>* pool = findPool<T>())
+				pool->forEach(std::forward<F>(function));
+		}
+
+		/**
+		 * @brief Destroy all ui-elements
+		 *
+		 * @details All handles become stale, the memory of the pools is kept for new ui-elements
+		 */
+		void clear()
+		{
+			for (auto& [type, pool] : pools)
+				pool->clear();
+		}
+	};
+} // namespace uie
+
+/**
+ * @class uie::ElementRegistry
+ *
+ * @details
+ * Usage Example:
+ * @code
+ * uie::ElementRegistry registry;
+ * uie::Handle<uie::Button> button = registry.create<uie::Button>(sf::FloatRect(0, 0, 200, 100), "Button", 30, font);
+ *
+ * uie::LineLayout<uie::Handle<>> layout({ 0, 0, 500, 500 }, { button });
+ *
+ * registry.destroy(button);
+ * button.isValid(); // false
+ *
+ * // A screen built in an arena, released at once when the arena goes out of scope
+ * std::pmr::monotonic_buffer_resource arena;
+ * uie::ElementRegistry screen(&arena);
+ * @endcode
+ */
\ No newline at end of file
@@ -0,0 +1,153 @@
+/*****************************************************************//**
+ * @file   EventDispatcher.hpp
+ * @brief  File containing the EventDispatcher class
+ *
+ * @author Bjorn Wakker
+ * @date   16 October 2026
+ *********************************************************************/
+#pragma once
+
+#include <UIElements/UIElement.hpp>
+#include <SFML/Window/Event.hpp>
+#include <cstdint>
+
+namespace uie
+{
+	/**
+	 * @brief Routes mouse events to the topmost ui-element under the pointer
+	 *
+	 * @details
+	 * The dispatcher keeps track of the hovered and pressed ui-element, so
+	 * mouseEntered, mouseLeft, mousePressed, mouseReleased and clicked
+	 * reach the right ui-element
+	 *
+	 * The last hit ui-element is cached, as long as no ui-element is marked LayoutDirty
+	 * a mouse move which stays inside it does not search the tree again.
+	 * Ui-elements which overlap one of their siblings can therefore keep the pointer
+	 * after it moved onto the sibling drawn on top
+	 *
+	 * A ui-element which is hovered or pressed must not be destroyed without calling reset
+	 *
+	 * @see UIElement::hitTest
+	 */
+	class EventDispatcher
+	{
+	private:
+		UIElement& root;							// The ui-element containing all others
+		UIElement* hovered = nullptr;				// The ui-element under the pointer
+		UIElement* pressed = nullptr;				// The ui-element the button was pressed on
+		sf::Mouse::Button pressedButton = sf::Mouse::Left;	// The button which was pressed
+		UIElement* lastHit = nullptr;				// The ui-element found by the last search
+		sf::Vector2f lastHitOffset;					// The difference between the point and the local point of the last hit
+		std::uint64_t lastHitGeneration = 0;		// The layout generation the last hit was found in
+		std::size_t searchCount = 0;				// The number of times the tree was searched
+
+		/**
+		 * @brief Find the topmost ui-element under a point
+		 *
+		 * @param[in] point The point, in the coordinates of the root
+		 *
+		 * @return The ui-element under the point, or nullptr if there is none
+		 */
+		UIElement* find(const sf::Vector2f& point);
+
+		/**
+		 * @brief Change the hovered ui-element, notifying the old and new one
+		 *
+		 * @param[in] element The new hovered ui-element
+		 */
+		void setHovered(UIElement* element);
+
+		/**
+		 * @brief Route an event to the ui-elements
+		 *
+		 * @param[in] event The event to route
+		 * @param[in] point The mouse position of the event, in the coordinates of the root
+		 *
+		 * @return True if the event was a mouse event on a ui-element, else false
+		 */
+		bool dispatch(const sf::Event& event, const sf::Vector2f& point);
+
+	public:
+		/**
+		 * @brief Overloaded constructor
+		 *
+		 * @param[in] root The ui-element containing all others
+		 */
+		EventDispatcher(UIElement& root);
+
+		/**
+		 * @brief Get the root
+		 *
+		 * @return The ui-element containing all others
+		 */
+		UIElement& getRoot() const;
+
+		/**
+		 * @brief Get the hovered ui-element
+		 *
+		 * @return The ui-element under the pointer, or nullptr if there is none
+		 */
+		UIElement* getHovered() const;
+
+		/**
+		 * @brief Get the pressed ui-element
+		 *
+		 * @return The ui-element a mouse button is held on, or nullptr if there is none
+		 */
+		UIElement* getPressed() const;
+
+		/**
+		 * @brief Get the number of times the tree was searched
+		 *
+		 * @details Mouse moves answered by the cached last hit are not counted
+		 *
+		 * @return The number of searches
+		 */
+		std::size_t getSearchCount() const;
+
+		/**
+		 * @brief Forget the hovered and pressed ui-element without notifying them
+		 *
+		 * @details Call this before destroying a ui-element which may be hovered or pressed
+		 */
+		void reset();
+
+		/**
+		 * @brief Handle an event
+		 *
+		 * @details The mouse coordinates of the event are used as the coordinates of the root
+		 *
+		 * @param[in] event The event to handle
+		 *
+		 * @return True if the event was a mouse event on a ui-element, else false
+		 */
+		bool handleEvent(const sf::Event& event);
+
+		/**
+		 * @brief Handle an event
+		 *
+		 * @details The mouse coordinates of the event are mapped using the current view of the target
+		 *
+		 * @param[in] event  The event to handle
+		 * @param[in] target The target the root is drawn to
+		 *
+		 * @return True if the event was a mouse event on a ui-element, else false
+		 */
+		bool handleEvent(const sf::Event& event, const sf::RenderTarget& target);
+	};
+} // namespace uie
+
+/**
+ * @class uie::EventDispatcher
+ *
+ * @details
+ * Usage Example:
+ * @code
+ * uie::EventDispatcher dispatcher(layout);
+ *
+ * sf::Event event;
+ * while (window.pollEvent(event))
+ *     dispatcher.handleEvent(event, window);
+ * @endcode
+ */
\ No newline at end of file
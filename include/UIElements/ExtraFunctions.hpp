@@ -8,7 +8,14 @@
 #pragma once
 
 #include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 #include <UIElements/UIElement.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <typeinfo>
+#include <vector>
 
 namespace uie
 {
@@ -54,6 +61,44 @@ namespace uie
 		return obj;
 	}
 
+	/**
+	 * @brief Check if an object can be used
+	 *
+	 * @details
+	 * A reference always refers to an object
+	 * If the object is a pointer, isValid(T*) will be called instead
+	 *
+	 * @tparam T The type
+	 *
+	 * @param[in] obj The object to check
+	 *
+	 * @return True
+	 *
+	 * @see isValid
+	 */
+	template<typename T>
+	bool isValid(const T& /*obj*/)
+	{
+		return true;
+	}
+
+	/**
+	 * @brief Check if a pointer can be used
+	 *
+	 * @tparam T The type
+	 *
+	 * @param[in] obj The pointer to check
+	 *
+	 * @return True if the pointer is not nullptr, else false
+	 *
+	 * @see isValid
+	 */
+	template<typename T>
+	bool isValid(T* obj)
+	{
+		return obj;
+	}
+
 	/**
 	 * @brief Get the string name of a type
 	 *
@@ -70,9 +115,9 @@ namespace uie
 	template <ImplementsUIElement T>
 	const char* getType(const T& val)
 	{
-		// If the type is a pointer to base, get the type of the derived class
-		if (typeid(T) == typeid(Any))
-			if (ptr(val))
+		// If the type is a pointer to base or a handle, get the type of the derived class
+		if (typeid(T) == typeid(Any) || requires { typename T::ElementType; })
+			if (isValid(val))
 				return typeid(*ptr(val)).name();
 
 		return typeid(T).name();
@@ -115,4 +160,118 @@ namespace uie
 
 		return { left, top, right - left, bottom - top };
 	}
+
+	/**
+	 * @brief Get the total rectangle boundaries
+	 *
+	 * @details Get the boundaries of a rectangle which covers both given rectangles, without allocating
+	 *
+	 * @tparam T The type of the rectangle
+	 * 
+	 * @param[in] first  The first rectangle which must be covered
+	 * @param[in] second The second rectangle which must be covered
+	 * 
+	 * @return A rectangle covering both rectangles
+	 */
+	template <typename T>
+	sf::Rect<T> getTotalRect(const sf::Rect<T>& first, const sf::Rect<T>& second)
+	{
+		T left = std::min(first.left, second.left);
+		T top = std::min(first.top, second.top);
+		T right = std::max(first.left + first.width, second.left + second.width);
+		T bottom = std::max(first.top + first.height, second.top + second.height);
+
+		return { left, top, right - left, bottom - top };
+	}
+
+	/**
+	 * @brief Get the area of a render target which is visible
+	 *
+	 * @details
+	 * The area covered by the current view of the target, mapped back through the
+	 * given transform so it can be compared with untransformed boundaries
+	 *
+	 * @param[in] target    The render target which is drawn to
+	 * @param[in] transform The transform the contents are drawn with
+	 * 
+	 * @return A rectangle covering the visible area
+	 */
+	inline sf::FloatRect getVisibleArea(const sf::RenderTarget& target, const sf::Transform& transform)
+	{
+		sf::FloatRect area = target.getView().getInverseTransform().transformRect({ -1, -1, 2, 2 });
+		return transform.getInverse().transformRect(area);
+	}
+
+	/**
+	 * @brief Check if a point lies inside a rounded rectangle
+	 *
+	 * @details
+	 * Points inside or outside the straight edges are decided without
+	 * computing a distance, only points near a corner are tested against its circle
+	 *
+	 * @param[in] rect   The boundaries of the rounded rectangle
+	 * @param[in] radius The radius of the corners, clamped to half the width and height
+	 * @param[in] point  The point to check for
+	 * 
+	 * @return True if the point lies inside, else false
+	 */
+	inline bool roundedRectContains(const sf::FloatRect& rect, float radius, const sf::Vector2f& point)
+	{
+		float halfWidth = rect.width / 2;
+		float halfHeight = rect.height / 2;
+		float x = std::abs(point.x - (rect.left + halfWidth));
+		float y = std::abs(point.y - (rect.top + halfHeight));
+
+		if (x > halfWidth || y > halfHeight)
+			return false;
+
+		radius = std::clamp(radius, 0.0f, std::min(halfWidth, halfHeight));
+
+		// Distance into the corner square, a point outside the corner squares is inside
+		float cornerX = x - (halfWidth - radius);
+		float cornerY = y - (halfHeight - radius);
+
+		if (cornerX <= 0 || cornerY <= 0)
+			return true;
+
+		return cornerX * cornerX + cornerY * cornerY <= radius * radius;
+	}
+
+	/**
+	 * @brief Check for many points if they lie inside a rounded rectangle
+	 *
+	 * @details
+	 * The loop has no branches, so the compiler can vectorise it
+	 * The results are stored as 0 or 1
+	 *
+	 * @param[in]  rect    The boundaries of the rounded rectangle
+	 * @param[in]  radius  The radius of the corners, clamped to half the width and height
+	 * @param[in]  points  The points to check for
+	 * @param[out] results The results, one for every point
+	 * 
+	 * @see roundedRectContains
+	 */
+	inline void roundedRectContains(const sf::FloatRect& rect, float radius, std::span<const sf::Vector2f> points, std::span<std::uint8_t> results)
+	{
+		float halfWidth = rect.width / 2;
+		float halfHeight = rect.height / 2;
+		float centerX = rect.left + halfWidth;
+		float centerY = rect.top + halfHeight;
+
+		radius = std::clamp(radius, 0.0f, std::min(halfWidth, halfHeight));
+
+		float innerWidth = halfWidth - radius;
+		float innerHeight = halfHeight - radius;
+		std::size_t count = std::min(points.size(), results.size());
+
+		for (std::size_t i = 0; i < count; i++)
+		{
+			float x = std::abs(points[i].x - centerX);
+			float y = std::abs(points[i].y - centerY);
+			float cornerX = std::max(x - innerWidth, 0.0f);
+			float cornerY = std::max(y - innerHeight, 0.0f);
+
+			results[i] = (x <= halfWidth) & (y <= halfHeight) & (cornerX * cornerX + cornerY * cornerY <= radius * radius);
+		}
+	}
 } // namespace uie
\ No newline at end of file
@@ -0,0 +1,59 @@
+/*****************************************************************//**
+ * @file   FontMetrics.hpp
+ * @brief  File containing the FontMetrics structure and its cache
+ *
+ * @author Bjorn Wakker
+ * @date   16 October 2026
+ *********************************************************************/
+#pragma once
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+namespace uie
+{
+	/**
+	 * @brief Vertical metrics of a font at a character size and style
+	 *
+	 * @details
+	 * SFML does not expose the ascent and descent of a font,
+	 * so they are measured on representative glyphs
+	 *
+	 * @see getFontMetrics
+	 */
+	struct FontMetrics
+	{
+		float ascent = 0;		// The height of capitals above the baseline, measured on 'H'
+		float descent = 0;		// The depth of descenders below the baseline, measured on 'g'
+		float lineHeight = 0;	// The distance between the baselines of two lines
+	};
+
+	/**
+	 * @brief Get the metrics of a font
+	 *
+	 * @details
+	 * The metrics are cached per font, character size and style, so only the
+	 * first call for a combination looks at the glyphs and allocates
+	 *
+	 * The cache refers to fonts by address, call clearFontMetrics and clearTextLayouts
+	 * before destroying a font if another font may be created at the same address
+	 *
+	 * @param[in] font          The font
+	 * @param[in] characterSize The size of the characters
+	 * @param[in] style         The text style, only sf::Text::Bold affects the metrics
+	 *
+	 * @return The metrics
+	 *
+	 * @see clearFontMetrics
+	 */
+	const FontMetrics& getFontMetrics(const sf::Font& font, unsigned int characterSize, unsigned int style = sf::Text::Regular);
+
+	/**
+	 * @brief Remove the cached metrics of a font
+	 *
+	 * @param[in] font The font
+	 *
+	 * @see getFontMetrics, clearTextLayouts
+	 */
+	void clearFontMetrics(const sf::Font& font);
+} // namespace uie
\ No newline at end of file
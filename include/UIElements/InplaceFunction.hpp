@@ -0,0 +1,209 @@
+/*****************************************************************//**
+ * @file   InplaceFunction.hpp
+ * @brief  File containing the InplaceFunction class
+ *
+ * @author Bjorn Wakker
+ * @date   16 October 2026
+ *********************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace uie
+{
+	template <typename Signature, std::size_t Capacity = 4 * sizeof(void*)>
+	class InplaceFunction;
+
+	/**
+	 * @brief Callable wrapper storing the callable inside itself
+	 *
+	 * @details
+	 * Works like std::function, but the callable is stored in a buffer of
+	 * a fixed size, so constructing, copying and moving never allocate
+	 *
+	 * A callable which does not fit the buffer is a compile error instead of
+	 * a hidden allocation, capture a pointer to larger state instead
+	 *
+	 * @tparam R        The return type
+	 * @tparam Args     The argument types
+	 * @tparam Capacity The size of the buffer in bytes
+	 */
+	template <typename R, typename... Args, std::size_t Capacity>
+	class InplaceFunction<R(Args...), Capacity>
+	{
+	private:
+		// The operations on the stored callable, one static table per callable type
+		struct Operations
+		{
+			R (*invoke)(void* callable, Args&&... args);
+			void (*copy)(void* destination, const void* source);
+			void (*move)(void* destination, void* source) noexcept;
+			void (*destroy)(void* callable) noexcept;
+		};
+
+		template <typename F>
+		static constexpr Operations operationsFor = {
+			[](void* callable, Args&&... args) -> R
+			{
+				return std::invoke(*static_cast<F*>(callable), std::forward<Args>(args)...);
+			},
+			[](void* destination, const void* source)
+			{
+				new (destination) F(*static_cast<const F*>(source));
+			},
+			[](void* destination, void* source) noexcept
+			{
+				new (destination) F(std::move(*static_cast<F*>(source)));
+				static_cast<F*>(source)->~F();
+			},
+			[](void* callable) noexcept
+			{
+				static_cast<F*>(callable)->~F();
+			}
+		};
+
+		alignas(std::max_align_t) std::byte storage[Capacity];	// The stored callable
+		const Operations* operations = nullptr;					// The operations of the stored callable, nullptr if empty
+
+	public:
+		InplaceFunction() = default;
+
+		InplaceFunction(std::nullptr_t)
+		{
+
+		}
+
+		/**
+		 * @brief Overloaded constructor
+		 *
+		 * @param[in] callable The callable to store, its size may not exceed the capacity
+		 */
+		template <typename F>
+			requires (!std::is_same_v<std::remove_cvref_t<F>, InplaceFunction> && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+		InplaceFunction(F&& callable)
+		{
+			using Callable = std::decay_t<F>;
+
+			static_assert(sizeof(Callable) <= Capacity, "The callable does not fit the buffer of the InplaceFunction");
+			static_assert(alignof(Callable) <= alignof(std::max_align_t), "The callable is over-aligned");
+			static_assert(std::is_nothrow_move_constructible_v<Callable>, "The callable must be nothrow move constructible");
+
+			// An empty function pointer stays an empty function, like std::function
+			if constexpr (std::is_pointer_v<std::remove_reference_t<F>> || std::is_member_pointer_v<Callable>)
+				if (!callable)
+					return;
+
+			new (storage) Callable(std::forward<F>(callable));
+			operations = &operationsFor<Callable>;
+		}
+
+		InplaceFunction(const InplaceFunction& other)
+		{
+			if (other.operations)
+				other.operations->copy(storage, other.storage);
+
+			operations = other.operations;
+		}
+
+		InplaceFunction(InplaceFunction&& other) noexcept
+		{
+			if (other.operations)
+				other.operations->move(storage, other.storage);
+
+			operations = other.operations;
+			other.operations = nullptr;
+		}
+
+		~InplaceFunction()
+		{
+			if (operations)
+				operations->destroy(storage);
+		}
+
+		InplaceFunction& operator=(const InplaceFunction& other)
+		{
+			if (this != &other)
+			{
+				InplaceFunction copy(other);
+				*this = std::move(copy);
+			}
+
+			return *this;
+		}
+
+		InplaceFunction& operator=(InplaceFunction&& other) noexcept
+		{
+			if (this != &other)
+			{
+				if (operations)
+					operations->destroy(storage);
+
+				if (other.operations)
+					other.operations->move(storage, other.storage);
+
+				operations = other.operations;
+				other.operations = nullptr;
+			}
+
+			return *this;
+		}
+
+		InplaceFunction& operator=(std::nullptr_t)
+		{
+			if (operations)
+				operations->destroy(storage);
+
+			operations = nullptr;
+			return *this;
+		}
+
+		/**
+		 * @brief Call the stored callable
+		 *
+		 * @param[in] args The arguments passed to the callable
+		 *
+		 * @return The result of the callable
+		 */
+		R operator()(Args... args) const
+		{
+			if (!operations)
+				throw std::bad_function_call();
+
+			return operations->invoke(const_cast<std::byte*>(storage), std::forward<Args>(args)...);
+		}
+
+		explicit operator bool() const
+		{
+			return operations;
+		}
+	};
+
+	/**
+	 * @brief Callable for the event callbacks of ui-elements
+	 *
+	 * @details
+	 * Holds eight pointers, and at least a std::function, so callbacks which were
+	 * passed as a std::function or capture this and a std::string still fit
+	 *
+	 * @see Button::setOnClick
+	 */
+	typedef InplaceFunction<void(), (sizeof(std::function<void()>) > 8 * sizeof(void*)) ? sizeof(std::function<void()>) : 8 * sizeof(void*)> Callback;
+} // namespace uie
+
+/**
+ * @class uie::InplaceFunction
+ *
+ * @details
+ * Usage Example:
+ * @code
+ * int clicks = 0;
+ * uie::InplaceFunction<void()> onClick = [&clicks]() { clicks++; };
+ *
+ * uie::InplaceFunction<void()> copy = onClick; // No allocation
+ * copy();
+ * @endcode
+ */
\ No newline at end of file
@@ -3,7 +3,16 @@
 #include <UIElements/UIElement.hpp>
 #include <UIElements/RoundedRectangle.hpp>
 #include <UIElements/Alignment.hpp>
+#include <UIElements/ExtraFunctions.hpp>
+#include <UIElements/BatchRenderer.hpp>
+#include <UIElements/RenderCache.hpp>
+#include <UIElements/SpatialIndex.hpp>
 #include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
 #include <stdexcept>
 #include <format>
 
@@ -19,6 +28,26 @@ namespace uie
 		Alignment verticalAlignment = Top;
 		AlignmentAxis axis = Vertical;
 		float spacing = 0;
+		mutable RenderCache cache;
+		sf::Vector2f offset;
+		sf::Vector2f contentSize;
+		unsigned int updateDepth = 0;
+		std::vector<sf::Vector2f> measuredSizes;
+		mutable unsigned int visibleElementCount = 0;
+		mutable SpatialIndex index;
+		mutable bool indexValid = false;
+		mutable std::unordered_map<const UIElement*, std::size_t> indexIds;	// The id of every element in the spatial index
+		mutable std::vector<std::size_t> changedIds;	// The elements whose boundaries changed since the index was updated
+		mutable std::vector<std::size_t> queryResult;
+		std::vector<float> pointsX;
+		std::vector<float> pointsY;
+		std::vector<std::uint32_t> candidates;
+
+		// Above this number of elements, testing every point against every element costs more than the spatial index
+		static constexpr std::size_t BatchBoundsLimit = 64;
+		static constexpr std::uint32_t NoCandidate = ~std::uint32_t(0);
+		// Pointers and handles keep referring to the same element when the vector reallocates
+		static constexpr bool StoresValues = std::is_base_of_v<UIElement, T>;
 
 		void checkAlignment()
 		{
@@ -47,16 +76,289 @@ namespace uie
 			}
 		}
 
-		sf::Vector2f getTotalElementsSize()
+		// Measure every element once per layout pass, unchanged elements return their last measurement
+		void measureElements()
+		{
+			measuredSizes.resize(elements.size());
+
+			for (std::size_t i = 0; i < elements.size(); i++)
+				measuredSizes[i] = ptr(elements[i])->measure(frame.getSize());
+		}
+
+		sf::Vector2f measureContent() const
 		{
 			sf::Vector2f size;
 
-			for (T& element : elements)
-				size += ptr(element)->getGlobalBounds().getSize();
+			for (const sf::Vector2f& elementSize : measuredSizes)
+			{
+				if (axis & Horizontal)
+				{
+					size.x += elementSize.x;
+
+					if (elementSize.y > size.y)
+						size.y = elementSize.y;
+				}
+				else if (axis & Vertical)
+				{
+					size.y += elementSize.y;
+
+					if (elementSize.x > size.x)
+						size.x = elementSize.x;
+				}
+			}
+
+			if (measuredSizes.empty())
+				return size;
+
+			if (axis & Horizontal)
+				size.x += spacing * (measuredSizes.size() - 1);
+			else if (axis & Vertical)
+				size.y += spacing * (measuredSizes.size() - 1);
 
 			return size;
 		}
 
+		void resizeFrame(bool allowShrink)
+		{
+			sf::Vector2f size = getSize();
+
+			if ((contentSize.x > size.x) || (contentSize.x < size.x && allowShrink))
+				size.x = contentSize.x;
+
+			if ((contentSize.y > size.y) || (contentSize.y < size.y && allowShrink))
+				size.y = contentSize.y;
+
+			if (size != getSize())
+				frame.setSize(size);
+		}
+
+		// Only with everything aligned to the start, a change shifts just the elements after it
+		bool canUpdateIncrementally() const
+		{
+			return updateDepth == 0 && !isLayoutDirty() && horizontalAlignment & Left && verticalAlignment & Top;
+		}
+
+		void placeAppendedElements(std::size_t first, const T* previousData)
+		{
+			if (!canUpdateIncrementally())
+			{
+				correctContentPosition(true);
+				return;
+			}
+
+			// Elements stored by value move when the vector reallocates, only then all of them need to be adopted again
+			if (StoresValues && elements.data() != previousData)
+			{
+				adoptElements(0);
+
+				// The index knows the elements by their old addresses
+				indexValid = false;
+			}
+			else
+			{
+				adoptElements(first);
+			}
+
+			sf::Vector2f position = frame.getLayoutPosition();
+
+			if (first > 0)
+			{
+				sf::FloatRect previous = ptr(elements[first - 1])->getCachedLayoutBounds();
+
+				if (axis & Horizontal)
+					position.x = previous.left + previous.width + spacing;
+				else if (axis & Vertical)
+					position.y = previous.top + previous.height + spacing;
+			}
+
+			for (std::size_t i = first; i < elements.size(); i++)
+			{
+				Any pElement = ptr(elements[i]);
+				sf::Vector2f size = pElement->measure(frame.getSize());
+				pElement->arrange({ position, size });
+
+				if (indexValid)
+				{
+					index.insert(i, pElement->getCachedLayoutBounds());
+					indexIds[pElement] = i;
+				}
+
+				float distance = (i > 0) ? spacing : 0;
+
+				if (axis & Horizontal)
+				{
+					position.x += size.x + spacing;
+					contentSize.x += size.x + distance;
+					contentSize.y = std::max(contentSize.y, size.y);
+				}
+				else if (axis & Vertical)
+				{
+					position.y += size.y + spacing;
+					contentSize.y += size.y + distance;
+					contentSize.x = std::max(contentSize.x, size.x);
+				}
+			}
+
+			sf::Vector2f size = frame.getSize();
+
+			if (contentSize.x > size.x || contentSize.y > size.y)
+				frame.setSize({ std::max(size.x, contentSize.x), std::max(size.y, contentSize.y) });
+
+			cache.invalidate();
+
+			frame.clearDirty(LayoutDirty);
+			clearDirty(LayoutDirty);
+		}
+
+		void adoptElements(std::size_t first) const
+		{
+			for (std::size_t i = first; i < elements.size(); i++)
+				ptr(elements[i])->setParent(this);
+		}
+
+		void adoptChildren() const
+		{
+			frame.setParent(this);
+			adoptElements(0);
+		}
+
+		void clearPaintDirty() const
+		{
+			frame.clearDirty(PaintDirty);
+
+			for (const T& element : elements)
+				ptr(element)->clearDirty(PaintDirty);
+
+			clearDirty(PaintDirty);
+		}
+
+		// The index is rebuilt lazily, the first query after a layout pass pays for it
+		void updateIndex() const
+		{
+			if (indexValid)
+			{
+				// Between layout passes only the elements which changed are moved in the index
+				for (std::size_t id : changedIds)
+					index.insert(id, ptr(elements[id])->getCachedLayoutBounds());
+
+				changedIds.clear();
+				return;
+			}
+
+			float totalSize = 0;
+
+			for (const T& element : elements)
+			{
+				sf::FloatRect bounds = ptr(element)->getCachedLayoutBounds();
+				totalSize += std::max(bounds.width, bounds.height);
+			}
+
+			index.reset(elements.empty() ? 1 : 2 * totalSize / elements.size());
+
+			indexIds.clear();
+			changedIds.clear();
+
+			for (std::size_t i = 0; i < elements.size(); i++)
+			{
+				index.insert(i, ptr(elements[i])->getCachedLayoutBounds());
+				indexIds[ptr(elements[i])] = i;
+			}
+
+			indexValid = true;
+		}
+
+		void batchContent(BatchRenderer& renderer, sf::RenderStates states) const
+		{
+			sf::FloatRect visibleArea = getVisibleArea(renderer.getTarget(), states.transform);
+			visibleElementCount = 0;
+
+			if (frame.getCachedLayoutBounds().intersects(visibleArea))
+				renderer.draw(frame, states);
+
+			for (const T& element : elements)
+			{
+				if (!ptr(element)->getCachedLayoutBounds().intersects(visibleArea))
+					continue;
+
+				renderer.draw(*ptr(element), states);
+				visibleElementCount++;
+			}
+		}
+
+		bool updateCache() const
+		{
+			if (!cache.isEnabled())
+				return false;
+
+			sf::FloatRect bounds = frame.getLayoutBounds();
+
+			if (cache.needsUpdate(bounds) || isPaintDirty())
+			{
+				sf::RenderTarget* cacheTarget = cache.begin(bounds);
+
+				if (!cacheTarget)
+					return false;
+
+				BatchRenderer renderer(*cacheTarget);
+				batchContent(renderer, sf::RenderStates::Default);
+				renderer.flush();
+				cache.end();
+			}
+
+			return true;
+		}
+
+	protected:
+		sf::Vector2f getContentOffset() const override
+		{
+			return offset;
+		}
+
+		void childLayoutChanged(const UIElement& child) const override
+		{
+			if (!indexValid)
+				return;
+
+			auto id = indexIds.find(&child);
+
+			// The frame is not in the index
+			if (id == indexIds.end())
+				return;
+
+			// Many changes at once, such as a layout pass, are cheaper to handle by rebuilding the index
+			if (changedIds.size() > elements.size() / 4)
+				indexValid = false;
+			else
+				changedIds.push_back(id->second);
+		}
+
+		sf::Vector2f measureOverride(const sf::Vector2f&) override
+		{
+			checkAlignment();
+			adoptChildren();
+			measureElements();
+			contentSize = measureContent();
+
+			// The frame only grows to fit the elements
+			sf::Vector2f boundsSize = getCachedLayoutBounds().getSize();
+			sf::Vector2f size = getSize();
+
+			return { boundsSize.x + std::max(0.0f, contentSize.x - size.x), boundsSize.y + std::max(0.0f, contentSize.y - size.y) };
+		}
+
+		void arrangeOverride(const sf::FloatRect& rect) override
+		{
+			sf::FloatRect bounds = getCachedLayoutBounds();
+
+			if (rect.getPosition() != bounds.getPosition())
+				move(rect.getPosition() - bounds.getPosition());
+
+			if (rect.getSize() != bounds.getSize())
+				frame.setSize(getSize() + rect.getSize() - bounds.getSize());
+
+			correctContentPosition();
+		}
+
 	public:
 		struct Attributes
 		{
@@ -71,13 +373,17 @@ namespace uie
 		/*          Functional          */
 		/*------------------------------*/
 
-		LineLayout() = default;
+		LineLayout()
+		{
+			adoptChildren();
+		}
 
 		LineLayout(const sf::Vector2f& position, const sf::Vector2f& size)
 		{
 			frame = RoundedRectangle(position, size);
 			frame.setFillColor(sf::Color::Transparent);
 			frame.makeRectangle();
+			adoptChildren();
 		}
 
 		LineLayout(const sf::Vector2f& position, const sf::Vector2f& size, const Attributes& attributes)
@@ -124,6 +430,86 @@ namespace uie
 
 		}
 
+		LineLayout(const sf::Vector2f& position, const sf::Vector2f& size, std::vector<T>&& elements)
+			: LineLayout(position, size)
+		{
+			this->elements = std::move(elements);
+			correctContentPosition(true);
+		}
+
+		LineLayout(const sf::Vector2f& position, const sf::Vector2f& size, const Attributes& attributes, std::vector<T>&& elements)
+			: LineLayout(position, size, attributes)
+		{
+			this->elements = std::move(elements);
+			correctContentPosition(true);
+		}
+
+		LineLayout(const sf::FloatRect& rect, std::vector<T>&& elements)
+			: LineLayout(rect.getPosition(), rect.getSize(), std::move(elements))
+		{
+
+		}
+
+		LineLayout(const sf::FloatRect& rect, const Attributes& attributes, std::vector<T>&& elements)
+			: LineLayout(rect.getPosition(), rect.getSize(), attributes, std::move(elements))
+		{
+
+		}
+
+		LineLayout(const LineLayout& other)
+			: UIElement(other), frame(other.frame), elements(other.elements), horizontalAlignment(other.horizontalAlignment),
+			verticalAlignment(other.verticalAlignment), axis(other.axis), spacing(other.spacing), cache(other.cache), offset(other.offset), contentSize(other.contentSize)
+		{
+			adoptChildren();
+		}
+
+		LineLayout(LineLayout&& other)
+			: UIElement(std::move(other)), frame(std::move(other.frame)), elements(std::move(other.elements)), horizontalAlignment(other.horizontalAlignment),
+			verticalAlignment(other.verticalAlignment), axis(other.axis), spacing(other.spacing), cache(std::move(other.cache)), offset(other.offset), contentSize(other.contentSize)
+		{
+			adoptChildren();
+		}
+
+		~LineLayout()
+		{
+			// Pointer elements outlive the layout, so they should not keep referring to it
+			for (const T& element : elements)
+				if (isValid(element) && ptr(element)->getParent() == this)
+					ptr(element)->setParent(nullptr);
+		}
+
+		LineLayout& operator=(const LineLayout& other)
+		{
+			UIElement::operator=(other);
+			frame = other.frame;
+			elements = other.elements;
+			horizontalAlignment = other.horizontalAlignment;
+			verticalAlignment = other.verticalAlignment;
+			axis = other.axis;
+			spacing = other.spacing;
+			cache = other.cache;
+			offset = other.offset;
+			contentSize = other.contentSize;
+			adoptChildren();
+			return *this;
+		}
+
+		LineLayout& operator=(LineLayout&& other)
+		{
+			UIElement::operator=(std::move(other));
+			frame = std::move(other.frame);
+			elements = std::move(other.elements);
+			horizontalAlignment = other.horizontalAlignment;
+			verticalAlignment = other.verticalAlignment;
+			axis = other.axis;
+			spacing = other.spacing;
+			cache = std::move(other.cache);
+			offset = other.offset;
+			contentSize = other.contentSize;
+			adoptChildren();
+			return *this;
+		}
+
 		void setAttributes(const Attributes& attributes)
 		{
 			horizontalAlignment = attributes.horizontalAlignment;
@@ -131,29 +517,38 @@ namespace uie
 			axis = attributes.axis;
 			spacing = attributes.spacing;
 			frame.setAttributes(attributes.frameAttributes);
+			cache.invalidate();
+			markDirty();
 		}
 
 		RoundedRectangle& getFrame()
 		{
+			frame.setParent(this);
 			return frame;
 		}
 
 		void setFrame(const RoundedRectangle& frame)
 		{
+			// Keep the global position of the frame, it is drawn at the offset of the layout
 			this->frame = frame;
+			this->frame.setPosition(frame.getPosition());
 			correctContentPosition();
 		}
 
 		T& getElement(unsigned int idx)
 		{
 			if (idx >= elements.size())
-				throw std::exception("Index out of range");
+				throw std::out_of_range("Index out of range");
 
+			ptr(elements[idx])->setParent(this);
 			return elements[idx];
 		}
 
 		std::vector<T>& getElements()
 		{
+			// The elements may be replaced or reordered
+			indexValid = false;
+			adoptChildren();
 			return elements;
 		}
 
@@ -162,16 +557,84 @@ namespace uie
 			return elements.size();
 		}
 
+		unsigned int getVisibleElementCount() const
+		{
+			return visibleElementCount;
+		}
+
+		// The topmost element containing the point, or nullptr if there is none
+		Any getElementAt(const sf::Vector2f& point)
+		{
+			sf::Vector2f local = point - getParentOffset() - offset;
+
+			updateIndex();
+			index.query(local, queryResult);
+
+			for (auto it = queryResult.rbegin(); it != queryResult.rend(); it++)
+				if (ptr(elements[*it])->intersects(point))
+					return ptr(elements[*it]);
+
+			return nullptr;
+		}
+
+		// The indices of the elements whose boundaries intersect the rectangle, in drawing order
+		void getElementsIn(const sf::FloatRect& rect, std::vector<std::size_t>& indices) const
+		{
+			updateIndex();
+			index.query({ rect.getPosition() - getParentOffset() - offset, rect.getSize() }, indices);
+		}
+
+		const SpatialIndex& getSpatialIndex() const
+		{
+			updateIndex();
+			return index;
+		}
+
 		void addElement(const T& element)
 		{
+			const T* previousData = elements.data();
 			elements.push_back(element);
-			correctContentPosition(true);
+			placeAppendedElements(elements.size() - 1, previousData);
+		}
+
+		void addElement(T&& element)
+		{
+			const T* previousData = elements.data();
+			elements.push_back(std::move(element));
+			placeAppendedElements(elements.size() - 1, previousData);
+		}
+
+		// Construct the element in place at the end of the layout
+		template <typename... Args>
+		T& emplaceElement(Args&&... args)
+		{
+			const T* previousData = elements.data();
+			elements.emplace_back(std::forward<Args>(args)...);
+			placeAppendedElements(elements.size() - 1, previousData);
+			return elements.back();
 		}
 
 		void addElements(const std::vector<T>& elements)
 		{
+			std::size_t first = this->elements.size();
+			const T* previousData = this->elements.data();
 			this->elements.insert(this->elements.end(), elements.begin(), elements.end());
-			correctContentPosition(true);
+			placeAppendedElements(first, previousData);
+		}
+
+		void addElements(std::vector<T>&& elements)
+		{
+			std::size_t first = this->elements.size();
+			const T* previousData = this->elements.data();
+
+			// An empty layout takes over the buffer instead of moving the elements one by one
+			if (this->elements.empty())
+				this->elements = std::move(elements);
+			else
+				this->elements.insert(this->elements.end(), std::make_move_iterator(elements.begin()), std::make_move_iterator(elements.end()));
+
+			elements.clear();
+			placeAppendedElements(first, previousData);
 		}
 
 		void removeElement(unsigned int idx)
@@ -179,8 +642,71 @@ namespace uie
 			if (idx >= elements.size())
 				throw std::out_of_range("Index out of range");
 
+			Any pRemoved = ptr(elements[idx]);
+
+			// Elements stored by value are destroyed, their slot keeps its parent for the element moved into it
+			if (!StoresValues && pRemoved->getParent() == this)
+				pRemoved->setParent(nullptr);
+
+			// The indices of the following elements change
+			indexValid = false;
+
+			if (!canUpdateIncrementally())
+			{
+				elements.erase(elements.begin() + idx);
+				correctContentPosition(true);
+				return;
+			}
+
+			sf::FloatRect removed = pRemoved->getCachedLayoutBounds();
+			float distance = (elements.size() > 1) ? spacing : 0;
+			sf::Vector2f shift;
+
+			if (axis & Horizontal)
+			{
+				shift.x = -(removed.width + distance);
+				contentSize.x += shift.x;
+			}
+			else if (axis & Vertical)
+			{
+				shift.y = -(removed.height + distance);
+				contentSize.y += shift.y;
+			}
+
+			// Assignment keeps the parent of the slots the following elements move into
 			elements.erase(elements.begin() + idx);
-			correctContentPosition(true);
+
+			for (std::size_t i = idx; i < elements.size(); i++)
+			{
+				ptr(elements[i])->move(shift);
+				ptr(elements[i])->clearDirty(LayoutDirty);
+			}
+
+			// The widest element may have been removed
+			if ((axis & Horizontal && removed.height >= contentSize.y) || (axis & Vertical && removed.width >= contentSize.x))
+			{
+				measureElements();
+				contentSize = measureContent();
+			}
+
+			cache.invalidate();
+			markDirty(PaintDirty);
+			frame.clearDirty(LayoutDirty);
+			clearDirty(LayoutDirty);
+		}
+
+		void beginUpdate()
+		{
+			updateDepth++;
+		}
+
+		void endUpdate()
+		{
+			if (updateDepth == 0)
+				throw std::logic_error("endUpdate() called without a matching beginUpdate()");
+
+			if (--updateDepth == 0)
+				correctContentPosition(true);
 		}
 
 		/*------------------------------*/
@@ -192,6 +718,7 @@ namespace uie
 			return frame.getLocalBounds();
 		}
 
+		// The frame is a child of the layout, so it includes the offset of the layout and of its parents
 		sf::FloatRect getGlobalBounds() const override
 		{
 			return frame.getGlobalBounds();
@@ -204,8 +731,7 @@ namespace uie
 
 		void setPosition(const sf::Vector2f& position) override
 		{
-			frame.setPosition(position);
-			correctContentPosition();
+			move(position - getPosition());
 		}
 
 		sf::Vector2f getSize() const override
@@ -221,10 +747,14 @@ namespace uie
 
 		void move(const sf::Vector2f& offset) override
 		{
-			frame.move(offset);
+			// The content is drawn relative to the offset, so moving does not change its layout
+			bool layoutDirty = isLayoutDirty();
 
-			for (T& element : elements)
-				ptr(element)->move(offset);
+			this->offset += offset;
+			markDirty();
+
+			if (!layoutDirty)
+				clearDirty(LayoutDirty);
 		}
 
 		bool intersects(const sf::Vector2f& point) const override
@@ -237,18 +767,162 @@ namespace uie
 			return frame.intersects(rect);
 		}
 
+		UIElement* hitTest(const sf::Vector2f& point, sf::Vector2f* localPoint = nullptr) override
+		{
+			if (!intersects(point + getParentOffset()))
+				return nullptr;
+
+			sf::Vector2f local = point - offset;
+
+			updateIndex();
+			index.query(local, queryResult);
+
+			// Elements added later are drawn on top, so they are tested first
+			for (auto it = queryResult.rbegin(); it != queryResult.rend(); it++)
+				if (UIElement* hit = ptr(elements[*it])->hitTest(local, localPoint))
+					return hit;
+
+			if (localPoint)
+				*localPoint = point;
+
+			return this;
+		}
+
+		void hitTest(std::span<const sf::Vector2f> points, std::span<UIElement*> hits) override
+		{
+			std::size_t count = std::min(points.size(), hits.size());
+
+			if (elements.size() > BatchBoundsLimit)
+			{
+				for (std::size_t i = 0; i < count; i++)
+					hits[i] = hitTest(points[i]);
+
+				return;
+			}
+
+			// The points in the coordinates of the elements, as separate arrays so the loops vectorise
+			pointsX.resize(count);
+			pointsY.resize(count);
+			candidates.assign(count, NoCandidate);
+
+			for (std::size_t i = 0; i < count; i++)
+			{
+				pointsX[i] = points[i].x - offset.x;
+				pointsY[i] = points[i].y - offset.y;
+			}
+
+			// Later elements are drawn on top, so they overwrite earlier candidates
+			for (std::size_t e = 0; e < elements.size(); e++)
+			{
+				const sf::FloatRect& bounds = ptr(elements[e])->getCachedLayoutBounds();
+				float left = bounds.left;
+				float top = bounds.top;
+				float right = bounds.left + bounds.width;
+				float bottom = bounds.top + bounds.height;
+				std::uint32_t id = static_cast<std::uint32_t>(e);
+
+				for (std::size_t i = 0; i < count; i++)
+				{
+					bool inside = (pointsX[i] >= left) & (pointsX[i] < right) & (pointsY[i] >= top) & (pointsY[i] < bottom);
+					candidates[i] = inside ? id : candidates[i];
+				}
+			}
+
+			sf::Vector2f parentOffset = getParentOffset();
+
+			for (std::size_t i = 0; i < count; i++)
+			{
+				if (!intersects(points[i] + parentOffset))
+				{
+					hits[i] = nullptr;
+					continue;
+				}
+
+				if (candidates[i] == NoCandidate)
+				{
+					hits[i] = this;
+					continue;
+				}
+
+				// The exact shape of the topmost candidate can miss the point, an element below it may still be hit
+				UIElement* hit = ptr(elements[candidates[i]])->hitTest({ pointsX[i], pointsY[i] });
+				hits[i] = hit ? hit : hitTest(points[i]);
+			}
+		}
+
 		void draw(sf::RenderTarget& target, sf::RenderStates states) const override
 		{
-			target.draw(frame, states);
+			states.transform.translate(offset);
+
+			if (updateCache())
+			{
+				cache.draw(target, states, frame.getLayoutBounds().getPosition());
+				clearPaintDirty();
+				return;
+			}
+
+			sf::FloatRect visibleArea = getVisibleArea(target, states.transform);
+			visibleElementCount = 0;
+
+			if (frame.getCachedLayoutBounds().intersects(visibleArea))
+				target.draw(frame, states);
 
 			for (const T& element : elements)
+			{
+				if (!ptr(element)->getCachedLayoutBounds().intersects(visibleArea))
+					continue;
+
 				ptr(element)->draw(target, states);
+				visibleElementCount++;
+			}
+
+			clearPaintDirty();
+		}
+
+		void batch(BatchRenderer& renderer, sf::RenderStates states) const override
+		{
+			states.transform.translate(offset);
+
+			if (updateCache())
+				cache.batch(renderer, states, frame.getLayoutBounds().getPosition());
+			else
+				batchContent(renderer, states);
+
+			clearPaintDirty();
+		}
+
+		void updateLayout() override
+		{
+			// Laid out once by endUpdate()
+			if (updateDepth == 0)
+				UIElement::updateLayout();
+		}
+
+		void applyStyles() override
+		{
+			for (T& element : elements)
+				ptr(element)->applyStyles();
 		}
 
 		/*------------------------------*/
 		/*            Visual            */
 		/*------------------------------*/
 
+		bool isCachedToTexture() const
+		{
+			return cache.isEnabled();
+		}
+
+		void cacheToTexture(bool cached = true)
+		{
+			cache.setEnabled(cached);
+		}
+
+		void invalidateCache()
+		{
+			cache.invalidate();
+		}
+
 		Alignment getHorizontalContentAlignment() const
 		{
 			return horizontalAlignment;
@@ -295,54 +969,36 @@ namespace uie
 
 		void updateSize(bool allowShrink = false)
 		{
-			sf::Vector2f totalSize;
-
-			for (T& element : elements)
-			{
-				sf::FloatRect bounds = ptr(element)->getGlobalBounds();
-
-				if (axis & Horizontal)
-				{
-					totalSize.x += bounds.width;
-
-					if (bounds.height > totalSize.y)
-						totalSize.y = bounds.height;
-				}
-				else if (axis & Vertical)
-				{
-					totalSize.y += bounds.height;
-
-					if (bounds.width > totalSize.x)
-						totalSize.x = bounds.width;
-				}
-			}
-
-			if (axis & Horizontal)
-				totalSize.x += spacing * (elements.size() - 1);
-			else if (axis & Vertical)
-				totalSize.y += spacing * (elements.size() - 1);
-
-			sf::Vector2f size = getSize();
-
-			if ((totalSize.x > size.x) || (totalSize.x < size.x && allowShrink))
-				size.x = totalSize.x;
-
-			if ((totalSize.y > size.y) || (totalSize.y < size.y && allowShrink))
-				size.y = totalSize.y;
-
-			frame.setSize(size);
+			measureElements();
+			contentSize = measureContent();
+			resizeFrame(allowShrink);
 		}
 
 		void correctContentPosition(bool updateFrameSize = false, bool allowShrink = false)
 		{
 			checkAlignment();
 
+			// Laid out once by endUpdate()
+			if (updateDepth > 0)
+			{
+				markDirty(LayoutDirty);
+				return;
+			}
+
+			adoptChildren();
+			measureElements();
+			contentSize = measureContent();
+
 			if (updateFrameSize)
-				updateSize(allowShrink);
+				resizeFrame(allowShrink);
+
+			sf::Vector2f totalElementsSize;
+
+			for (const sf::Vector2f& elementSize : measuredSizes)
+				totalElementsSize += elementSize;
 
-			sf::FloatRect frameBounds = getGlobalBounds();
-			sf::Vector2f position = getPosition();
-			sf::Vector2f totalElementsSize = getTotalElementsSize();
+			sf::FloatRect frameBounds = frame.getCachedLayoutBounds();
+			sf::Vector2f position = frame.getLayoutPosition();
 			float totalSpacing = spacing * (elements.size() - 1);
 			float spacing = this->spacing;
 
@@ -356,47 +1012,60 @@ namespace uie
 				spacing /= elements.size() - 1;
 			}
 
-			for (T& element : elements)
+			for (std::size_t i = 0; i < elements.size(); i++)
 			{
-				Any pElement = ptr(element);
-				sf::FloatRect elementBounds = pElement->getGlobalBounds();
-				pElement->move(position - elementBounds.getPosition());
+				Any pElement = ptr(elements[i]);
+				const sf::Vector2f& elementSize = measuredSizes[i];
+				sf::Vector2f target = position;
 
 				if (horizontalAlignment & Center)
 				{
 					if (axis & Horizontal)
-						pElement->move({ frameBounds.width / 2 - (totalElementsSize.x + totalSpacing + 2) / 2, 0 });
+						target.x += frameBounds.width / 2 - (totalElementsSize.x + totalSpacing + 2) / 2;
 					else if (axis & Vertical)
-						pElement->move({ frameBounds.width / 2 - elementBounds.width / 2, 0 });
+						target.x += frameBounds.width / 2 - elementSize.x / 2;
 				}
 				else if (horizontalAlignment & Right)
 				{
 					if (axis & Horizontal)
-						pElement->move({ frameBounds.width - (totalElementsSize.x + totalSpacing + 2), 0 });
+						target.x += frameBounds.width - (totalElementsSize.x + totalSpacing + 2);
 					else if (axis & Vertical)
-						pElement->move({ frameBounds.width - (elementBounds.width + 2), 0 });
+						target.x += frameBounds.width - (elementSize.x + 2);
 				}
 
 				if (verticalAlignment & Center)
 				{
 					if (axis & Horizontal)
-						pElement->move({ 0, frameBounds.height / 2 - elementBounds.height / 2 });
+						target.y += frameBounds.height / 2 - elementSize.y / 2;
 					else if (axis & Vertical)
-						pElement->move({ 0, frameBounds.height / 2 - (totalElementsSize.y + totalSpacing + 2) / 2 });
+						target.y += frameBounds.height / 2 - (totalElementsSize.y + totalSpacing + 2) / 2;
 				}
 				else if (verticalAlignment & Bottom)
 				{
 					if (axis & Horizontal)
-						pElement->move({ 0, frameBounds.height - (elementBounds.height + 2) });
+						target.y += frameBounds.height - (elementSize.y + 2);
 					else if (axis & Vertical)
-						pElement->move({ 0, frameBounds.height - (totalElementsSize.y + totalSpacing + 2) });
+						target.y += frameBounds.height - (totalElementsSize.y + totalSpacing + 2);
 				}
 
+				// Unchanged elements which are already in place are skipped by arrange
+				pElement->arrange({ target, elementSize });
+
 				if (axis & Horizontal)
-					position.x += elementBounds.width + spacing;
+					position.x += elementSize.x + spacing;
 				else if (axis & Vertical)
-					position.y += elementBounds.height + spacing;
+					position.y += elementSize.y + spacing;
 			}
+
+			indexValid = false;
+			cache.invalidate();
+
+			frame.clearDirty(LayoutDirty);
+
+			for (T& element : elements)
+				ptr(element)->clearDirty(LayoutDirty);
+
+			clearDirty(LayoutDirty);
 		}
 	};
 } // namespace uie
\ No newline at end of file
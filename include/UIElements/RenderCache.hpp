@@ -0,0 +1,167 @@
+/*****************************************************************//**
+ * @file   RenderCache.hpp
+ * @brief  File containing the RenderCache class
+ *
+ * @author Bjorn Wakker
+ * @date   16 October 2026
+ *********************************************************************/
+#pragma once
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <memory>
+
+namespace uie
+{
+	class BatchRenderer;
+
+	/**
+	 * @brief Texture cache for the rendered contents of a ui-element
+	 *
+	 * @details
+	 * The contents are rasterised once into a render texture, after which
+	 * drawing them only costs a single textured quad until the cache is invalidated
+	 *
+	 * Copying a cache does not copy the texture, the copy will be rendered
+	 * again the first time it is drawn
+	 *
+	 * @see Container, LineLayout
+	 */
+	class RenderCache
+	{
+	private:
+		std::unique_ptr<sf::RenderTexture> texture;	// The texture holding the rendered contents
+		sf::FloatRect bounds;						// The area which was rendered to the texture
+		bool enabled = false;						// If the cache is used
+		bool valid = false;							// If the texture holds the current contents
+
+		/**
+		 * @brief Create the textured quad covering the cached contents
+		 *
+		 * @param[out] quad     The four vertices of the quad, as a triangle strip
+		 * @param[in]  position The position of the quad
+		 */
+		void makeQuad(sf::Vertex* quad, const sf::Vector2f& position) const;
+
+	public:
+		/**
+		 * @brief The default constructor
+		 */
+		RenderCache() = default;
+
+		/**
+		 * @brief Copy constructor
+		 *
+		 * @details Copies if the cache is enabled, the texture itself is not copied
+		 *
+		 * @param[in] other The cache to copy
+		 */
+		RenderCache(const RenderCache& other);
+
+		/**
+		 * @brief Move constructor
+		 *
+		 * @param[in] other The cache to move
+		 */
+		RenderCache(RenderCache&& other) noexcept = default;
+
+		/**
+		 * @brief Copy assignment
+		 *
+		 * @details Copies if the cache is enabled, the texture itself is not copied
+		 *
+		 * @param[in] other The cache to copy
+		 *
+		 * @return A reference to this cache
+		 */
+		RenderCache& operator=(const RenderCache& other);
+
+		/**
+		 * @brief Move assignment
+		 *
+		 * @param[in] other The cache to move
+		 *
+		 * @return A reference to this cache
+		 */
+		RenderCache& operator=(RenderCache&& other) noexcept = default;
+
+		/**
+		 * @brief Check if the cache is enabled
+		 *
+		 * @return True if the cache is enabled, else false
+		 *
+		 * @see setEnabled
+		 */
+		bool isEnabled() const;
+
+		/**
+		 * @brief Enable or disable the cache
+		 *
+		 * @details Disabling the cache releases the texture
+		 *
+		 * @param[in] enabled Should the cache be used?
+		 *
+		 * @see isEnabled
+		 */
+		void setEnabled(bool enabled);
+
+		/**
+		 * @brief Mark the cached contents as outdated
+		 *
+		 * @details The contents will be rendered again the next time they are drawn
+		 */
+		void invalidate();
+
+		/**
+		 * @brief Check if the contents have to be rendered again
+		 *
+		 * @details
+		 * The contents have to be rendered again if they were invalidated or
+		 * if the size of the area changed. A change in position only moves the quad.
+		 *
+		 * @param[in] area The area which is covered by the contents
+		 *
+		 * @return True if the contents have to be rendered again, else false
+		 */
+		bool needsUpdate(const sf::FloatRect& area) const;
+
+		/**
+		 * @brief Start rendering the contents
+		 *
+		 * @details
+		 * Prepares and clears the texture, the view of the returned target
+		 * is set to the given area
+		 *
+		 * @param[in] area The area which is covered by the contents
+		 *
+		 * @return The target to render the contents to, or nullptr if the texture could not be created
+		 *
+		 * @see end
+		 */
+		sf::RenderTarget* begin(const sf::FloatRect& area);
+
+		/**
+		 * @brief Finish rendering the contents
+		 *
+		 * @see begin
+		 */
+		void end();
+
+		/**
+		 * @brief Draw the cached contents to a rendertarget
+		 *
+		 * @param[in] target   Render target to draw to
+		 * @param[in] states   Current render states
+		 * @param[in] position The current position of the area
+		 */
+		void draw(sf::RenderTarget& target, sf::RenderStates states, const sf::Vector2f& position) const;
+
+		/**
+		 * @brief Append the cached contents to a batch renderer
+		 *
+		 * @param[in] renderer Batch renderer to append to
+		 * @param[in] states   Current render states
+		 * @param[in] position The current position of the area
+		 */
+		void batch(BatchRenderer& renderer, sf::RenderStates states, const sf::Vector2f& position) const;
+	};
+} // namespace uie
\ No newline at end of file
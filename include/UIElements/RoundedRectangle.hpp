@@ -9,6 +9,9 @@
 
 #include <UIElements/UIElement.hpp>
 #include <SFML/Graphics/RoundedRectangleShape.hpp>
+#include <vector>
+#include <span>
+#include <cstdint>
 
 namespace uie
 {
@@ -26,6 +29,28 @@ namespace uie
 	private:
 		sf::RoundedRectangleShape rectangle;    // The rectangle shape
 
+		mutable std::vector<sf::Vertex> fillVertices;		// The fill geometry used for batching, in local coordinates
+		mutable std::vector<sf::Vertex> outlineVertices;	// The outline geometry used for batching, in local coordinates
+		mutable bool geometryNeedUpdate = true;				// If the batching geometry has to be recomputed
+
+		/**
+		 * @brief Recompute the batching geometry if it is outdated
+		 * 
+		 * @details 
+		 * The fill is stored as a triangle fan and the outline as a triangle strip,
+		 * the same way sf::Shape computes them
+		 * 
+		 * @see batch
+		 */
+		void ensureGeometryUpdate() const;
+
+		/**
+		 * @brief Get the radius of the outer edge of the corners
+		 * 
+		 * @return The corner radius including the outline
+		 */
+		float getOuterRadius() const;
+
 	public:
 		/**
 		 * @brief Structure for additional attributes
@@ -44,9 +69,13 @@ namespace uie
 		/**
 		 * @brief Default constructor
 		 * 
+		 * @details
+		 * The shape is only tessellated when its boundaries are needed or when it is drawn,
+		 * so setting multiple attributes after each other results in a single rebuild
+		 * 
 		 * @see RoundedRectangle
 		 */
-		RoundedRectangle() = default;
+		RoundedRectangle();
 
 		/**
 		 * @brief Overloaded constructor
@@ -100,6 +129,42 @@ namespace uie
 		 */
 		RoundedRectangle(const sf::FloatRect& rect, const Attributes& attributes);
 
+		/**
+		 * @brief Copy constructor
+		 *
+		 * @param[in] other The rounded rectangle to copy
+		 */
+		RoundedRectangle(const RoundedRectangle& other) = default;
+
+		/**
+		 * @brief Move constructor
+		 *
+		 * @details
+		 * Members which SFML only allows to copy, such as the vertex arrays of sf::Shape, are still copied
+		 * The move may allocate, so it is not declared noexcept
+		 *
+		 * @param[in] other The rounded rectangle to move
+		 */
+		RoundedRectangle(RoundedRectangle&& other) = default;
+
+		/**
+		 * @brief Copy assignment
+		 *
+		 * @param[in] other The rounded rectangle to copy
+		 *
+		 * @return A reference to this rounded rectangle
+		 */
+		RoundedRectangle& operator=(const RoundedRectangle& other) = default;
+
+		/**
+		 * @brief Move assignment
+		 *
+		 * @param[in] other The rounded rectangle to move
+		 *
+		 * @return A reference to this rounded rectangle
+		 */
+		RoundedRectangle& operator=(RoundedRectangle&& other) = default;
+
 		/**
 		 * @brief Set all the specified attributes
 		 * 
@@ -174,7 +239,9 @@ namespace uie
 		/**
 		 * @brief Check for intersection
 		 *
-		 * @details Check if the point intersects with the rectangle
+		 * @details 
+		 * Check if the point intersects with the rectangle,
+		 * points in the cut off area of a rounded corner do not intersect
 		 *
 		 * @param[in] point The point to check for
 		 * 
@@ -182,6 +249,16 @@ namespace uie
 		 */
 		bool intersects(const sf::Vector2f& point) const override;
 
+		/**
+		 * @brief Check for intersection of many points
+		 *
+		 * @details The same test as for a single point, for all points at once
+		 *
+		 * @param[in]  points  The points to check for
+		 * @param[out] results 1 on intersection, else 0, one for every point
+		 */
+		void intersects(std::span<const sf::Vector2f> points, std::span<std::uint8_t> results) const;
+
 		/**
 		 * @brief Check for intersection
 		 *
@@ -201,6 +278,16 @@ namespace uie
 		 */
 		void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
+		/**
+		 * @brief Append the rectangle to a batch renderer
+		 *
+		 * @param[in] renderer Batch renderer to append to
+		 * @param[in] states   Current render states
+		 * 
+		 * @see BatchRenderer
+		 */
+		void batch(BatchRenderer& renderer, sf::RenderStates states) const override;
+
 		/**
 		 * @brief Get the radius of the rounded corners
 		 *
@@ -0,0 +1,171 @@
+/*****************************************************************//**
+ * @file   SpatialIndex.hpp
+ * @brief  File containing the SpatialIndex class
+ *
+ * @author Bjorn Wakker
+ * @date   16 October 2026
+ *********************************************************************/
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace uie
+{
+	/**
+	 * @brief Uniform grid for finding rectangles by point or area
+	 *
+	 * @details
+	 * Every rectangle is stored under an id in all the grid cells it overlaps,
+	 * so a query only has to look at the rectangles in the cells it touches
+	 * instead of at every rectangle
+	 *
+	 * The ids are chosen by the user, layouts use the index of their elements
+	 *
+	 * @see LineLayout
+	 */
+	class SpatialIndex
+	{
+	private:
+		float cellSize;											// The width and height of a cell
+		std::unordered_map<std::uint64_t, std::vector<std::size_t>> cells;	// The ids stored per cell
+		std::vector<sf::FloatRect> rects;						// The rectangle of every id
+		std::vector<bool> used;									// If an id is stored
+		std::size_t count = 0;									// The number of stored ids
+
+		/**
+		 * @brief Get the key of a cell
+		 *
+		 * @param[in] x The column of the cell
+		 * @param[in] y The row of the cell
+		 *
+		 * @return The key of the cell
+		 */
+		static std::uint64_t getKey(std::int32_t x, std::int32_t y);
+
+		/**
+		 * @brief Get the column or row a coordinate falls in
+		 *
+		 * @param[in] coordinate The coordinate
+		 *
+		 * @return The column or row
+		 */
+		std::int32_t getCell(float coordinate) const;
+
+		/**
+		 * @brief Call a function for every cell a rectangle overlaps
+		 *
+		 * @param[in] rect     The rectangle
+		 * @param[in] function The function taking the key of the cell
+		 */
+		template <typename F>
+		void forEachCell(const sf::FloatRect& rect, F&& function) const
+		{
+			std::int32_t left = getCell(rect.left);
+			std::int32_t top = getCell(rect.top);
+			std::int32_t right = getCell(rect.left + rect.width);
+			std::int32_t bottom = getCell(rect.top + rect.height);
+
+			for (std::int32_t y = top; y <= bottom; y++)
+				for (std::int32_t x = left; x <= right; x++)
+					function(getKey(x, y));
+		}
+
+	public:
+		/**
+		 * @brief Overloaded constructor
+		 *
+		 * @param[in] cellSize The width and height of a cell
+		 */
+		SpatialIndex(float cellSize = 128);
+
+		/**
+		 * @brief Get the size of the cells
+		 *
+		 * @return The width and height of a cell
+		 */
+		float getCellSize() const;
+
+		/**
+		 * @brief Remove all rectangles and change the size of the cells
+		 *
+		 * @details
+		 * Cells about twice the size of the average rectangle keep
+		 * both the number of cells per rectangle and per query low
+		 *
+		 * @param[in] cellSize The width and height of a cell
+		 */
+		void reset(float cellSize);
+
+		/**
+		 * @brief Remove all rectangles
+		 */
+		void clear();
+
+		/**
+		 * @brief Get the number of stored rectangles
+		 *
+		 * @return The number of rectangles
+		 */
+		std::size_t size() const;
+
+		/**
+		 * @brief Check if an id is stored
+		 *
+		 * @param[in] id The id to check
+		 *
+		 * @return True if the id is stored, else false
+		 */
+		bool contains(std::size_t id) const;
+
+		/**
+		 * @brief Store or move a rectangle
+		 *
+		 * @details If the id is already stored, its rectangle is replaced
+		 *
+		 * @param[in] id   The id of the rectangle
+		 * @param[in] rect The rectangle
+		 */
+		void insert(std::size_t id, const sf::FloatRect& rect);
+
+		/**
+		 * @brief Remove a rectangle
+		 *
+		 * @param[in] id The id of the rectangle
+		 */
+		void remove(std::size_t id);
+
+		/**
+		 * @brief Find the rectangles containing a point
+		 *
+		 * @param[in]  point The point
+		 * @param[out] ids   The ids of the rectangles, in ascending order
+		 */
+		void query(const sf::Vector2f& point, std::vector<std::size_t>& ids) const;
+
+		/**
+		 * @brief Find the rectangles intersecting a rectangle
+		 *
+		 * @param[in]  rect The rectangle
+		 * @param[out] ids  The ids of the rectangles, in ascending order
+		 */
+		void query(const sf::FloatRect& rect, std::vector<std::size_t>& ids) const;
+	};
+} // namespace uie
+
+/**
+ * @class uie::SpatialIndex
+ *
+ * @details
+ * Usage Example:
+ * @code
+ * uie::SpatialIndex index(64);
+ * index.insert(0, { 0, 0, 50, 50 });
+ * index.insert(1, { 40, 40, 50, 50 });
+ *
+ * std::vector<std::size_t> ids;
+ * index.query(sf::Vector2f(45, 45), ids); // ids = { 0, 1 }
+ * @endcode
+ */
\ No newline at end of file
@@ -0,0 +1,189 @@
+/*****************************************************************//**
+ * @file   StatsRenderTarget.hpp
+ * @brief  File containing the StatsRenderTarget class
+ *
+ * @author Bjorn Wakker
+ * @date   16 October 2026
+ *********************************************************************/
+#pragma once
+
+#include <UIElements/BatchRenderer.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <map>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace uie
+{
+	/**
+	 * @brief Structure holding the rendering counters of a frame
+	 *
+	 * @see StatsRenderTarget
+	 */
+	struct RenderStats
+	{
+		/**
+		 * @brief Structure holding the counters of a single ui-element type
+		 */
+		struct ElementStats
+		{
+			std::size_t elements = 0;	// The number of elements drawn
+			std::size_t appends = 0;	// The number of pieces of geometry appended, the draw calls without batching
+			std::size_t vertices = 0;	// The number of vertices appended
+		};
+
+		std::size_t drawCalls = 0;			// The number of draw calls submitted to the target
+		std::size_t unbatchedDraws = 0;		// The number of draw calls which could not be batched
+		std::size_t primitives = 0;			// The number of points, lines and triangles submitted
+		std::size_t vertices = 0;			// The number of vertices submitted
+		std::size_t textureBinds = 0;		// The number of times the texture changed between draw calls
+		std::unordered_map<std::type_index, ElementStats> elementTypes;	// The counters per ui-element type
+
+		/**
+		 * @brief Set all the counters back to zero
+		 */
+		void reset();
+
+		/**
+		 * @brief Get the counters per ui-element type for reporting
+		 *
+		 * @return The counters per ui-element type, by the name given by typeid
+		 */
+		std::map<std::string, ElementStats> getElementTypesByName() const;
+	};
+
+	/**
+	 * @brief Batch renderer which counts the draw calls, vertices and texture binds of a frame
+	 *
+	 * @details
+	 * The counters are collected while drawing, the geometry is optionally
+	 * forwarded to a real render target. Without a target nothing is drawn,
+	 * which allows measuring a frame without an OpenGL context.
+	 *
+	 * The draw calls are counted after batching, the appends of an element
+	 * type are the draw calls it would make without batching
+	 *
+	 * @see RenderStats, BatchRenderer
+	 */
+	class StatsRenderTarget : public BatchRenderer
+	{
+	private:
+		/**
+		 * @brief Render target which discards everything drawn to it
+		 *
+		 * @details Only keeps a view, so ui-elements can still cull against it
+		 */
+		class NullTarget : public sf::RenderTarget
+		{
+		private:
+			sf::Vector2u size;
+
+		public:
+			NullTarget(const sf::Vector2u& size);
+			sf::Vector2u getSize() const override;
+			bool setActive(bool active = true) override;
+		};
+
+		std::unique_ptr<NullTarget> nullTarget;			// The target used when counting only
+		RenderStats stats;								// The counters of the current frame
+		std::vector<RenderStats::ElementStats*> drawing;	// The counters of the ui-elements currently being drawn
+		const sf::Texture* lastTexture = nullptr;		// The texture of the previous draw call
+		bool hasLastTexture = false;					// If the texture of the previous draw call is known
+
+		/**
+		 * @brief Constructor taking ownership of the target
+		 *
+		 * @param[in] target The target to draw to
+		 */
+		StatsRenderTarget(std::unique_ptr<NullTarget> target);
+
+		/**
+		 * @brief Count a draw call
+		 *
+		 * @param[in] texture     The texture used by the draw call
+		 * @param[in] hasTexture  If the texture of the draw call is known
+		 */
+		void countDrawCall(const sf::Texture* texture, bool hasTexture);
+
+	protected:
+		void submit(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states) override;
+		void submit(const sf::Drawable& drawable, const sf::RenderStates& states) override;
+
+	public:
+		/**
+		 * @brief Overloaded constructor, counting only
+		 *
+		 * @details Nothing is drawn, the size is used for the view ui-elements cull against
+		 *
+		 * @param[in] size The size of the target being measured
+		 */
+		StatsRenderTarget(const sf::Vector2u& size);
+
+		/**
+		 * @brief Overloaded constructor, counting and drawing
+		 *
+		 * @param[in] target The render target to forward the draw calls to
+		 */
+		StatsRenderTarget(sf::RenderTarget& target);
+
+		/**
+		 * @brief Destructor
+		 *
+		 * @details Flushes the remaining batches
+		 */
+		~StatsRenderTarget() override;
+
+		/**
+		 * @brief Check if the draw calls are forwarded to a real render target
+		 *
+		 * @return True if drawing, false if only counting
+		 */
+		bool isForwarding() const;
+
+		/**
+		 * @brief Get the counters
+		 *
+		 * @details Call flush first to include the pending batches
+		 *
+		 * @return The counters since the last reset
+		 *
+		 * @see reset
+		 */
+		const RenderStats& getStats() const;
+
+		/**
+		 * @brief Set all the counters back to zero, usually at the start of a frame
+		 *
+		 * @see getStats
+		 */
+		void reset();
+
+		/*------------------------------*/
+		/*   Batch renderer overrides   */
+		/*------------------------------*/
+
+		void draw(const UIElement& element, const sf::RenderStates& states = sf::RenderStates::Default) override;
+		void append(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states, const sf::Color& color = sf::Color::White) override;
+	};
+} // namespace uie
+
+/**
+ * @class uie::StatsRenderTarget
+ *
+ * @details
+ * Usage Example:
+ * @code
+ * uie::StatsRenderTarget renderer(window);
+ *
+ * window.clear();
+ * renderer.reset();
+ * renderer.draw(layout);
+ * renderer.flush();
+ * window.display();
+ *
+ * std::size_t drawCalls = renderer.getStats().drawCalls;
+ * @endcode
+ */
\ No newline at end of file
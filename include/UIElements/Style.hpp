@@ -0,0 +1,138 @@
+/*****************************************************************//**
+ * @file   Style.hpp
+ * @brief  File containing the Style class
+ *
+ * @author Bjorn Wakker
+ * @date   16 October 2026
+ *********************************************************************/
+#pragma once
+
+#include <UIElements/RoundedRectangle.hpp>
+#include <UIElements/Text.hpp>
+#include <cstdint>
+
+namespace uie
+{
+	/**
+	 * @brief Visual attributes shared by many ui-elements
+	 *
+	 * @details
+	 * Ui-elements refer to a style by pointer instead of each receiving the attributes
+	 * through their setters. Changing a style only changes the style itself, the
+	 * ui-elements using it pick up the change the next time updateLayout is called
+	 * on their root, all in the same pass
+	 *
+	 * A change which only affects colors does not cause the ui-elements to be laid out again
+	 *
+	 * A style must outlive the ui-elements using it
+	 *
+	 * @see Button::setStyle, Checkbox::setStyle, UIElement::applyStyles
+	 */
+	class Style
+	{
+	private:
+		RoundedRectangle::Attributes rectangleAttributes;	// The attributes of the rectangle
+		Text::Attributes textAttributes;					// The attributes of the text
+		std::uint64_t version = 1;							// Increased on every change
+		std::uint64_t layoutVersion = 1;					// The version of the last change which affects the layout
+
+		static std::uint64_t generation;					// Increased every time any style changes
+
+		/**
+		 * @brief Register a change
+		 *
+		 * @param[in] affectsLayout If the change affects more than the colors
+		 */
+		void changed(bool affectsLayout);
+
+	public:
+		/**
+		 * @brief The default constructor
+		 */
+		Style() = default;
+
+		/**
+		 * @brief Overloaded constructor
+		 *
+		 * @param[in] rectangleAttributes The attributes of the rectangle
+		 * @param[in] textAttributes      The attributes of the text
+		 */
+		Style(const RoundedRectangle::Attributes& rectangleAttributes, const Text::Attributes& textAttributes);
+
+		/**
+		 * @brief Get the attributes of the rectangle
+		 *
+		 * @return The attributes
+		 */
+		const RoundedRectangle::Attributes& getRectangleAttributes() const;
+
+		/**
+		 * @brief Set the attributes of the rectangle
+		 *
+		 * @param[in] attributes The attributes
+		 */
+		void setRectangleAttributes(const RoundedRectangle::Attributes& attributes);
+
+		/**
+		 * @brief Get the attributes of the text
+		 *
+		 * @return The attributes
+		 */
+		const Text::Attributes& getTextAttributes() const;
+
+		/**
+		 * @brief Set the attributes of the text
+		 *
+		 * @param[in] attributes The attributes
+		 */
+		void setTextAttributes(const Text::Attributes& attributes);
+
+		/**
+		 * @brief Get the version
+		 *
+		 * @return The version, which increases on every change
+		 */
+		std::uint64_t getVersion() const;
+
+		/**
+		 * @brief Apply the style to a rectangle and text if it changed since it was last applied
+		 *
+		 * @details Only the colors are set if nothing else changed
+		 *
+		 * @param[in]     rectangle      The rectangle
+		 * @param[in]     text           The text
+		 * @param[in,out] appliedVersion The version which was last applied, 0 if none
+		 *
+		 * @return The dirty flags the owner of the rectangle and text has to be marked with
+		 */
+		unsigned int apply(RoundedRectangle& rectangle, Text& text, std::uint64_t& appliedVersion) const;
+
+		/**
+		 * @brief Get the style generation
+		 *
+		 * @details
+		 * The generation increases every time any style changes,
+		 * updateLayout only walks the ui-elements when it did
+		 *
+		 * @return The current generation
+		 */
+		static std::uint64_t getGeneration();
+	};
+} // namespace uie
+
+/**
+ * @class uie::Style
+ *
+ * @details
+ * Usage Example:
+ * @code
+ * uie::Style primary({ .fillColor = sf::Color::Blue }, { .fillColor = sf::Color::White });
+ *
+ * for (uie::Button& button : buttons)
+ *     button.setStyle(&primary);
+ *
+ * // Every button is recolored during the next layout pass
+ * primary.setRectangleAttributes({ .fillColor = sf::Color::Red });
+ * layout.updateLayout();
+ * @endcode
+ */
\ No newline at end of file
@@ -8,7 +8,9 @@
 #pragma once
 
 #include <UIElements/UIElement.hpp>
+#include <UIElements/TextLayout.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <memory>
 
 namespace uie
 {
@@ -27,6 +29,39 @@ namespace uie
 		sf::Text label;		// The text
 		bool snap = true;	// If the position should round to an interger to prevent blurry text
 
+		mutable std::shared_ptr<const TextLayout> layout;	// The glyph quads and boundaries, shared with equal texts
+		mutable bool geometryNeedUpdate = true;				// If the layout has to be looked up again
+		mutable sf::Vector2f snapOffset;					// The offset which rounds the position to whole pixels
+		mutable sf::Vector2f snapTranslation;				// The translation drawn with when the snap offset was computed
+		mutable bool snapNeedUpdate = true;					// If the snap offset has to be recomputed
+
+		/**
+		 * @brief Look up the layout if it is outdated
+		 * 
+		 * @details 
+		 * The layout comes from the cache of getTextLayout, so texts with
+		 * the same string, font and style share their glyph quads
+		 * 
+		 * @see batch
+		 * @see getTextLayout
+		 */
+		void ensureGeometryUpdate() const;
+
+		/**
+		 * @brief Get the offset which rounds the position to whole pixels
+		 * 
+		 * @details 
+		 * The offset is only recomputed after the position, the boundaries or the translation
+		 * of the transform changed, so drawing a snapped text does not have to copy or measure it.
+		 * The transform includes the offsets of the layouts drawing the text,
+		 * so the position drawn at is snapped rather than the position in the layout
+		 * 
+		 * @param[in] transform The transform the text is drawn with
+		 * 
+		 * @return The offset to translate the text by
+		 */
+		const sf::Vector2f& getSnapOffset(const sf::Transform& transform) const;
+
 	public:
 		/**
 		 * @brief Structure for additional attributes
@@ -79,6 +114,42 @@ namespace uie
 		 * @see Text, Attributes, setAttributes
 		 */
 		Text(const sf::Vector2f& position, const sf::String& text, unsigned int characterSize, const sf::Font& font, const Attributes& attributes);
+
+		/**
+		 * @brief Copy constructor
+		 *
+		 * @param[in] other The text to copy
+		 */
+		Text(const Text& other) = default;
+
+		/**
+		 * @brief Move constructor
+		 *
+		 * @details
+		 * Members which SFML only allows to copy, such as sf::String, are still copied
+		 * The move may allocate, so it is not declared noexcept
+		 *
+		 * @param[in] other The text to move
+		 */
+		Text(Text&& other) = default;
+
+		/**
+		 * @brief Copy assignment
+		 *
+		 * @param[in] other The text to copy
+		 *
+		 * @return A reference to this text
+		 */
+		Text& operator=(const Text& other) = default;
+
+		/**
+		 * @brief Move assignment
+		 *
+		 * @param[in] other The text to move
+		 *
+		 * @return A reference to this text
+		 */
+		Text& operator=(Text&& other) = default;
 		
 		/**
 		 * @brief Set all the specified attributes
@@ -194,6 +265,20 @@ namespace uie
 		 */
 		void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
+		/**
+		 * @brief Append the text to a batch renderer
+		 *
+		 * @details
+		 * The glyphs of all texts which use the same font and character size
+		 * share a texture, so they can be merged into a single draw call
+		 * 
+		 * @param[in] renderer Batch renderer to append to
+		 * @param[in] states   Current render states
+		 * 
+		 * @see BatchRenderer
+		 */
+		void batch(BatchRenderer& renderer, sf::RenderStates states) const override;
+
 		/**
 		 * @brief Get the text's string
 		 *
@@ -0,0 +1,107 @@
+/*****************************************************************//**
+ * @file   TextLayout.hpp
+ * @brief  File containing the TextLayout structure and its cache
+ *
+ * @author Bjorn Wakker
+ * @date   16 October 2026
+ *********************************************************************/
+#pragma once
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <memory>
+#include <vector>
+
+namespace uie
+{
+	/**
+	 * @brief The laid out glyphs of a string, in local coordinates
+	 *
+	 * @details The vertices are white, so the colors can be applied when batching
+	 *
+	 * @see getTextLayout
+	 */
+	struct TextLayout
+	{
+		std::vector<sf::Vertex> fillVertices;		// The glyph quads and lines, as triangles
+		std::vector<sf::Vertex> outlineVertices;	// The outline glyph quads and lines, as triangles
+		sf::FloatRect bounds;						// The local boundaries, the same as sf::Text::getLocalBounds
+	};
+
+	/**
+	 * @brief Get the layout of a text, computing it if it is not cached
+	 *
+	 * @details
+	 * Texts with the same string, font, character size, style, spacing and outline
+	 * thickness share a single layout, only their transforms differ.
+	 * The layouts are kept in a bounded cache shared by all texts, the least
+	 * recently used layout is evicted once the cache is full, texts still
+	 * using an evicted layout keep it alive
+	 *
+	 * The cache refers to fonts by address, call clearTextLayouts and clearFontMetrics
+	 * before destroying a font if another font may be created at the same address
+	 *
+	 * The cache is not thread-safe, like the rest of the ui-elements
+	 *
+	 * @param[in] text The text
+	 *
+	 * @return The layout, empty if the text has no font or string
+	 *
+	 * @see clearTextLayouts, setTextLayoutCapacity
+	 */
+	std::shared_ptr<const TextLayout> getTextLayout(const sf::Text& text);
+
+	/**
+	 * @brief Remove the cached layouts of a font
+	 *
+	 * @param[in] font The font
+	 *
+	 * @see getTextLayout, clearFontMetrics
+	 */
+	void clearTextLayouts(const sf::Font& font);
+
+	/**
+	 * @brief Remove all cached layouts
+	 *
+	 * @see getTextLayout
+	 */
+	void clearTextLayouts();
+
+	/**
+	 * @brief Get the maximum number of cached layouts
+	 *
+	 * @return The capacity
+	 */
+	std::size_t getTextLayoutCapacity();
+
+	/**
+	 * @brief Set the maximum number of cached layouts
+	 *
+	 * @details Evicts the least recently used layouts if the cache holds more
+	 *
+	 * @param[in] capacity The capacity, 0 disables caching
+	 */
+	void setTextLayoutCapacity(std::size_t capacity);
+
+	/**
+	 * @brief Get the number of cached layouts
+	 *
+	 * @return The number of layouts
+	 */
+	std::size_t getTextLayoutCount();
+
+	/**
+	 * @brief Get the number of layouts which were found in the cache
+	 *
+	 * @return The number of hits
+	 */
+	std::size_t getTextLayoutHits();
+
+	/**
+	 * @brief Get the number of layouts which had to be computed
+	 *
+	 * @return The number of misses
+	 */
+	std::size_t getTextLayoutMisses();
+} // namespace uie
\ No newline at end of file
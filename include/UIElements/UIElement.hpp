@@ -9,9 +9,26 @@
 
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Window/Mouse.hpp>
+#include <cstdint>
+#include <span>
 
 namespace uie
 {
+	class BatchRenderer;
+
+	/**
+	 * @brief Flags describing what changed in a ui-element since it was last laid out or drawn
+	 * 
+	 * @see UIElement
+	 */
+	enum DirtyFlags
+	{
+		Clean = 0,
+		LayoutDirty = 1 << 0,
+		PaintDirty = 1 << 1
+	};
+
 	/**
 	 * @brief Specialized interface for all the ui-element classes
 	 * 
@@ -19,6 +36,20 @@ namespace uie
 	 */
 	class UIElement : public sf::Drawable
 	{
+	private:
+		mutable const UIElement* parent = nullptr;					// The ui-element containing this ui-element
+		mutable unsigned int dirtyFlags = LayoutDirty | PaintDirty;	// What changed since the last layout and draw
+		mutable sf::FloatRect cachedLayoutBounds;					// The layout boundaries at the time they were cached
+		mutable bool layoutBoundsValid = false;						// If the cached layout boundaries are up to date
+		mutable sf::Vector2f measuredAvailable;						// The available space of the last measurement
+		mutable sf::Vector2f measuredSize;							// The desired size of the last measurement
+		mutable bool measureValid = false;							// If the last measurement is up to date
+		mutable sf::FloatRect arrangedRect;							// The rectangle of the last arrangement
+		mutable bool arrangeValid = false;							// If the last arrangement is up to date
+		std::uint64_t appliedStyleGeneration = 0;					// The style generation of the last updateLayout
+
+		static std::uint64_t layoutGeneration;						// Increased every time any ui-element is marked LayoutDirty
+
 	protected:
 		/**
 		 * @brief Protected constructor
@@ -29,6 +60,120 @@ namespace uie
 		 */
 		UIElement() = default;
 
+		/**
+		 * @brief Copy constructor
+		 * 
+		 * @details The copy has no parent and is fully dirty
+		 * 
+		 * @param[in] other The ui-element to copy
+		 */
+		UIElement(const UIElement& other);
+
+		/**
+		 * @brief Move constructor
+		 *
+		 * @details The new ui-element has no parent and keeps the dirty flags of the moved ui-element
+		 *
+		 * @param[in] other The ui-element to move
+		 */
+		UIElement(UIElement&& other) noexcept;
+
+		/**
+		 * @brief Copy assignment
+		 *
+		 * @details The ui-element keeps its parent and is marked fully dirty
+		 *
+		 * @param[in] other The ui-element to copy
+		 * 
+		 * @return A reference to this ui-element
+		 */
+		UIElement& operator=(const UIElement& other);
+
+		/**
+		 * @brief Move assignment
+		 *
+		 * @details The ui-element keeps its parent and is marked fully dirty
+		 *
+		 * @param[in] other The ui-element to move
+		 *
+		 * @return A reference to this ui-element
+		 */
+		UIElement& operator=(UIElement&& other) noexcept;
+
+		/**
+		 * @brief Mark the ui-element as changed
+		 * 
+		 * @details 
+		 * The flags are added to the ui-element and to all of its parents,
+		 * so a layout knows one of its children changed
+		 * 
+		 * Use LayoutDirty for changes which affect the boundaries and
+		 * PaintDirty for changes which only affect how the ui-element looks
+		 * 
+		 * LayoutDirty also invalidates the cached layout boundaries, measurement
+		 * and arrangement of the ui-element and all of its parents
+		 * 
+		 * @param[in] flags The flags to add
+		 * 
+		 * @see DirtyFlags, clearDirty
+		 */
+		void markDirty(unsigned int flags = LayoutDirty | PaintDirty) const;
+
+		/**
+		 * @brief Compute the size the ui-element would like to have
+		 * 
+		 * @details
+		 * Ui-elements with children measure their children and return the size
+		 * needed to fit them. The default implementation returns the current size
+		 * of the global boundaries.
+		 * 
+		 * @param[in] available The space the parent can offer
+		 * 
+		 * @return The desired size of the global boundaries
+		 * 
+		 * @see measure
+		 */
+		virtual sf::Vector2f measureOverride(const sf::Vector2f& available);
+
+		/**
+		 * @brief Place the ui-element in its final rectangle
+		 * 
+		 * @details
+		 * Ui-elements with children also arrange their children. The default implementation
+		 * moves and resizes the ui-element so its layout boundaries match the rectangle.
+		 * 
+		 * @param[in] rect The final boundaries of the ui-element, in the layout coordinates of the parent
+		 * 
+		 * @see arrange
+		 */
+		virtual void arrangeOverride(const sf::FloatRect& rect);
+
+		/**
+		 * @brief Get the offset the children of the ui-element are drawn at
+		 * 
+		 * @details
+		 * Layouts move by translating their children when drawing, instead of moving
+		 * every child. The default implementation returns (0, 0).
+		 * 
+		 * @return The offset added to the coordinates of the children
+		 * 
+		 * @see getParentOffset
+		 */
+		virtual sf::Vector2f getContentOffset() const;
+
+		/**
+		 * @brief Called when a child of the ui-element is marked LayoutDirty
+		 * 
+		 * @details
+		 * Layouts use it to update only what they computed from the boundaries of the changed child.
+		 * The boundaries of the child may not be up to date yet. The default implementation does nothing.
+		 * 
+		 * @param[in] child The child which was marked, or which contains the marked ui-element
+		 * 
+		 * @see markDirty
+		 */
+		virtual void childLayoutChanged(const UIElement& child) const;
+
 	public:
 		/**
 		 * @brief Virtual destructor
@@ -47,9 +192,13 @@ namespace uie
 		/**
 		 * @brief Get the global boundaries of the ui-element
 		 *
-		 * @details The global boundaries are the boundaries of the ui-element at its position (x, y)
+		 * @details
+		 * The global boundaries are the boundaries of the ui-element at its position (x, y),
+		 * in the coordinates of the root, so they include the offsets of the layouts containing it
 		 *
 		 * @return The global boundaries
+		 * 
+		 * @see getParentOffset, getLayoutBounds
 		 */
 		virtual sf::FloatRect getGlobalBounds() const = 0;
 
@@ -129,6 +278,277 @@ namespace uie
 		 * @see sf::Drawable
 		 */
 		virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const = 0;
+
+		/**
+		 * @brief Append the ui-element to a batch renderer
+		 *
+		 * @details
+		 * Ui-elements which can provide their geometry append it to the renderer,
+		 * so it can be merged with the geometry of other ui-elements
+		 * 
+		 * The default implementation draws the ui-element without batching it
+		 *
+		 * @param[in] renderer Batch renderer to append to
+		 * @param[in] states   Current render states
+		 * 
+		 * @see BatchRenderer
+		 */
+		virtual void batch(BatchRenderer& renderer, sf::RenderStates states) const;
+
+		/**
+		 * @brief Lay out the contents of the ui-element if they changed
+		 * 
+		 * @details
+		 * Measures and arranges the ui-element at its current position, should be
+		 * called once per frame on the root of the ui-elements. Children which did
+		 * not change reuse their last measurement and arrangement.
+		 * 
+		 * Styles which changed since the last call are applied first.
+		 * 
+		 * @see measure, arrange, isLayoutDirty, applyStyles
+		 */
+		virtual void updateLayout();
+
+		/**
+		 * @brief Apply the styles which changed since they were last applied
+		 * 
+		 * @details
+		 * Ui-elements using a style apply it, ui-elements containing
+		 * others pass it on to their children
+		 * 
+		 * @see Style, updateLayout
+		 */
+		virtual void applyStyles();
+
+		/**
+		 * @brief Compute the size the ui-element would like to have
+		 * 
+		 * @details
+		 * The first pass of the layout protocol, the result is reused until
+		 * the ui-element is marked LayoutDirty or the available space changes
+		 * 
+		 * @param[in] available The space the parent can offer
+		 * 
+		 * @return The desired size of the global boundaries
+		 * 
+		 * @see measureOverride, arrange
+		 */
+		sf::Vector2f measure(const sf::Vector2f& available);
+
+		/**
+		 * @brief Place the ui-element in its final rectangle
+		 * 
+		 * @details
+		 * The second pass of the layout protocol, nothing is done if the ui-element
+		 * is not LayoutDirty and was already arranged in the same rectangle
+		 * Clears the LayoutDirty flag
+		 * 
+		 * @param[in] rect The final boundaries of the ui-element, in the layout coordinates of the parent
+		 * 
+		 * @see arrangeOverride, measure
+		 */
+		void arrange(const sf::FloatRect& rect);
+
+		/**
+		 * @brief Get the sum of the content offsets of all parents
+		 * 
+		 * @details
+		 * The difference between the coordinates the parent lays the ui-element out in
+		 * and the coordinates of the root, resolved by walking up the parents
+		 * 
+		 * @return The offset of the layout coordinates of the ui-element
+		 * 
+		 * @see getContentOffset
+		 */
+		sf::Vector2f getParentOffset() const;
+
+		/**
+		 * @brief Get the boundaries in the coordinates the parent lays the ui-element out in
+		 * 
+		 * @details Moving a parent does not change the layout boundaries of its children
+		 * 
+		 * @return The global boundaries without the parent offset
+		 * 
+		 * @see getGlobalBounds, getParentOffset
+		 */
+		sf::FloatRect getLayoutBounds() const;
+
+		/**
+		 * @brief Get the position in the coordinates the parent lays the ui-element out in
+		 * 
+		 * @return The position without the parent offset
+		 * 
+		 * @see getPosition, getParentOffset
+		 */
+		sf::Vector2f getLayoutPosition() const;
+
+		/**
+		 * @brief Get the layout boundaries, only computing them after they changed
+		 * 
+		 * @details
+		 * Caches the result of getLayoutBounds until the ui-element is marked LayoutDirty,
+		 * use this when the boundaries of the same ui-element are needed many times
+		 * 
+		 * @return The cached layout boundaries
+		 * 
+		 * @see getLayoutBounds, markDirty
+		 */
+		const sf::FloatRect& getCachedLayoutBounds() const;
+
+		/**
+		 * @brief Get the global boundaries, only computing the layout boundaries after they changed
+		 * 
+		 * @details The parent offset is resolved on every call, so moving a parent needs no invalidation
+		 * 
+		 * @return The cached layout boundaries moved by the parent offset
+		 * 
+		 * @see getCachedLayoutBounds, getParentOffset
+		 */
+		sf::FloatRect getCachedGlobalBounds() const;
+
+		/**
+		 * @brief Get the parent of the ui-element
+		 * 
+		 * @return The ui-element containing this ui-element, or nullptr if there is none
+		 * 
+		 * @see setParent
+		 */
+		const UIElement* getParent() const;
+
+		/**
+		 * @brief Set the parent of the ui-element
+		 * 
+		 * @details
+		 * Used by ui-elements containing other ui-elements to receive their changes
+		 * If the ui-element is dirty, the new parent is marked dirty as well
+		 * 
+		 * @param[in] parent The ui-element containing this ui-element
+		 * 
+		 * @see getParent
+		 */
+		void setParent(const UIElement* parent) const;
+
+		/**
+		 * @brief Get the dirty flags
+		 * 
+		 * @return The flags describing what changed since the last layout and draw
+		 * 
+		 * @see DirtyFlags
+		 */
+		unsigned int getDirtyFlags() const;
+
+		/**
+		 * @brief Check if the boundaries of the ui-element or its children changed since the last layout
+		 * 
+		 * @return True if the layout is outdated, else false
+		 */
+		bool isLayoutDirty() const;
+
+		/**
+		 * @brief Check if the ui-element or its children changed since they were last drawn
+		 * 
+		 * @return True if the drawn result is outdated, else false
+		 */
+		bool isPaintDirty() const;
+
+		/**
+		 * @brief Clear the dirty flags
+		 * 
+		 * @details Only clears the ui-element itself, its parents are not affected
+		 * 
+		 * @param[in] flags The flags to clear
+		 * 
+		 * @see markDirty
+		 */
+		void clearDirty(unsigned int flags = LayoutDirty | PaintDirty) const;
+
+		/**
+		 * @brief Get the layout generation
+		 * 
+		 * @details
+		 * The generation increases every time any ui-element is marked LayoutDirty,
+		 * a result computed from the boundaries of ui-elements stays valid as long as it does not change
+		 * 
+		 * @return The current layout generation
+		 * 
+		 * @see markDirty
+		 */
+		static std::uint64_t getLayoutGeneration();
+
+		/*------------------------------*/
+		/*            Events            */
+		/*------------------------------*/
+
+		/**
+		 * @brief Find the topmost ui-element under a point
+		 * 
+		 * @details
+		 * Ui-elements with children search their children first, the
+		 * default implementation returns this ui-element if it intersects the point
+		 * 
+		 * @param[in]  point      The point to check for, in the layout coordinates of the parent
+		 * @param[out] localPoint Optional, the point in the coordinates of the returned ui-element its parent
+		 * 
+		 * @return The ui-element under the point, or nullptr if there is none
+		 * 
+		 * @see EventDispatcher
+		 */
+		virtual UIElement* hitTest(const sf::Vector2f& point, sf::Vector2f* localPoint = nullptr);
+
+		/**
+		 * @brief Find the topmost ui-element under many points at once
+		 * 
+		 * @details
+		 * Gives the same results as testing every point on its own, layouts override
+		 * this to test all points against the boundaries of a child in one pass
+		 * 
+		 * @param[in]  points The points to check for, in the coordinates of the parent
+		 * @param[out] hits   The ui-element under every point, or nullptr if there is none
+		 * 
+		 * @see hitTest
+		 */
+		virtual void hitTest(std::span<const sf::Vector2f> points, std::span<UIElement*> hits);
+
+		/**
+		 * @brief Called when the mouse moves onto the ui-element
+		 * 
+		 * @see EventDispatcher
+		 */
+		virtual void mouseEntered();
+
+		/**
+		 * @brief Called when the mouse moves off the ui-element
+		 * 
+		 * @see EventDispatcher
+		 */
+		virtual void mouseLeft();
+
+		/**
+		 * @brief Called when a mouse button is pressed on the ui-element
+		 * 
+		 * @param[in] button The pressed button
+		 * 
+		 * @see EventDispatcher
+		 */
+		virtual void mousePressed(sf::Mouse::Button button);
+
+		/**
+		 * @brief Called when a mouse button is released on the ui-element
+		 * 
+		 * @param[in] button The released button
+		 * 
+		 * @see EventDispatcher
+		 */
+		virtual void mouseReleased(sf::Mouse::Button button);
+
+		/**
+		 * @brief Called when a mouse button is pressed and released on the ui-element
+		 * 
+		 * @param[in] button The clicked button
+		 * 
+		 * @see EventDispatcher
+		 */
+		virtual void clicked(sf::Mouse::Button button);
 	};
 
 	/**
@@ -141,12 +561,14 @@ namespace uie
 	/**
 	 * @brief Concept to check if a type is derived from the UIElement interface
 	 *
-	 * @tparam T The type to check if is derived from the interface, also allowing pointers to the type
+	 * @tparam T The type to check if is derived from the interface, also allowing pointers and handles to the type
 	 *
 	 * @see UIElement
+	 * @see Handle
 	 */
 	template <typename T>
-	concept ImplementsUIElement = std::is_base_of_v<UIElement, std::remove_pointer_t<T>>;
+	concept ImplementsUIElement = std::is_base_of_v<UIElement, std::remove_pointer_t<T>> ||
+		requires { requires std::is_base_of_v<UIElement, typename T::ElementType>; };
 } // namespace uie
 
 /**
@@ -162,6 +584,10 @@ namespace uie
  * Note that inheriting from UIElement is mandatory if you want
  * your class to work with the other ui-elements
  * 
+ * Layouts move their children by an offset when drawing them, a ui-element
+ * which may be placed in a layout adds getParentOffset to the global
+ * boundaries, position and intersection tests it reports
+ * 
  * Usage Example:
  * @code
  * class MyUIElement : public UIElement
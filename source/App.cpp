@@ -8,20 +8,21 @@ void App::start()
 
 	font.loadFromFile("resource\\arial.ttf");
 
-	r = RoundedRectangle({ 0, 0, 50, 50 }, { .fillColor = sf::Color::Cyan, .outlineThickness = 1 });
+	r = registry.create<RoundedRectangle>(RoundedRectangle({ 0, 0, 50, 50 }, { .fillColor = sf::Color::Cyan, .outlineThickness = 1 }));
 
-	r2 = RoundedRectangle(r);
-	r2.setFillColor(sf::Color::Yellow);
+	r2 = registry.create<RoundedRectangle>(*r);
+	r2->setFillColor(sf::Color::Yellow);
 
-	t = Text({ 0, 0 }, "Hello World!", 30, font, { .style = sf::Text::Italic | sf::Text::Underlined });
+	t = registry.create<Text>(Text({ 0, 0 }, "Hello World!", 30, font, { .style = sf::Text::Italic | sf::Text::Underlined }));
 
-	b = Button({ 0, 0, 200, 100 }, "I'm a button", 30, font);
+	b = registry.create<Button>(Button({ 0, 0, 200, 100 }, "I'm a button", 30, font));
+	b->setOnClick([this]() { cb->toggle(); });
 
-	cb = Checkbox({ 0, 0, 50, 50 }, "Check me!", 20, font);
+	cb = registry.create<Checkbox>(Checkbox({ 0, 0, 50, 50 }, "Check me!", 20, font));
 
-	c = Container({ 0, 0, 200, 200 }, { .containerAttributes = {.outlineThickness = 1} }, Text(t));
+	c = registry.create<Container<Text>>(Container({ 0, 0, 200, 200 }, { .containerAttributes = {.outlineThickness = 1} }, Text(*t)));
 
-	l = LineLayout({ 100, 100, 1720, 880 }, { .spacing = 20, .frameAttributes = {.outlineThickness = 1} }, { &r, &t, &b, &cb, &c, &r2 });
+	l = LineLayout<Handle<>>({ 100, 100, 1720, 880 }, { .spacing = 20, .frameAttributes = {.outlineThickness = 1} }, { r, t, b, cb, c, r2 });
 	
 	run();
 }
@@ -44,6 +45,8 @@ void App::handleEvents()
 
 	while (window.pollEvent(event))
 	{
+		dispatcher.handleEvent(event, window);
+
 		switch (event.type)
 		{
 		case sf::Event::Closed:
@@ -96,14 +99,15 @@ void App::handleEvents()
 
 void App::update()
 {
-
+	l.updateLayout();
 }
 
 void App::draw()
 {
 	window.clear(sf::Color::White);
 
-	window.draw(l);
+	renderer.draw(l);
+	renderer.flush();
 
 	sf::RectangleShape r1({ 1, 880 });
 	r1.setPosition({ 960, 100 });
@@ -0,0 +1,183 @@
+#include <UIElements/BatchRenderer.hpp>
+#include <algorithm>
+
+namespace uie
+{
+	bool BatchRenderer::canBatch(const sf::RenderStates& states)
+	{
+		return states.shader == nullptr && states.blendMode == sf::BlendAlpha;
+	}
+
+	BatchRenderer::BatchRenderer(sf::RenderTarget& target)
+		: target(target)
+	{
+
+	}
+
+	BatchRenderer::~BatchRenderer()
+	{
+		flush();
+	}
+
+	void BatchRenderer::submit(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states)
+	{
+		target.draw(vertices, vertexCount, type, states);
+	}
+
+	void BatchRenderer::submit(const sf::Drawable& drawable, const sf::RenderStates& states)
+	{
+		target.draw(drawable, states);
+	}
+
+	sf::RenderTarget& BatchRenderer::getTarget() const
+	{
+		return target;
+	}
+
+	unsigned int BatchRenderer::getLookBehind() const
+	{
+		return lookBehind;
+	}
+
+	void BatchRenderer::setLookBehind(unsigned int count)
+	{
+		lookBehind = count;
+	}
+
+	void BatchRenderer::draw(const UIElement& element, const sf::RenderStates& states)
+	{
+		element.batch(*this, states);
+	}
+
+	void BatchRenderer::append(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states, const sf::Color& color)
+	{
+		if (type != sf::Triangles && type != sf::TriangleStrip && type != sf::TriangleFan)
+		{
+			flush();
+			submit(vertices, vertexCount, type, states);
+			return;
+		}
+
+		if (vertexCount < 3)
+			return;
+
+		// Convert the geometry to a list of transformed triangles
+		scratch.clear();
+
+		auto add = [&](const sf::Vertex& vertex)
+		{
+			scratch.emplace_back(states.transform.transformPoint(vertex.position), vertex.color * color, vertex.texCoords);
+		};
+
+		if (type == sf::Triangles)
+		{
+			for (std::size_t i = 0; i + 2 < vertexCount; i += 3)
+			{
+				add(vertices[i]);
+				add(vertices[i + 1]);
+				add(vertices[i + 2]);
+			}
+		}
+		else if (type == sf::TriangleStrip)
+		{
+			for (std::size_t i = 2; i < vertexCount; i++)
+			{
+				add(vertices[i - 2]);
+				add(vertices[i - 1]);
+				add(vertices[i]);
+			}
+		}
+		else if (type == sf::TriangleFan)
+		{
+			for (std::size_t i = 2; i < vertexCount; i++)
+			{
+				add(vertices[0]);
+				add(vertices[i - 1]);
+				add(vertices[i]);
+			}
+		}
+
+		if (!canBatch(states))
+		{
+			flush();
+			submit(scratch.data(), scratch.size(), sf::Triangles, sf::RenderStates(states.blendMode, sf::Transform::Identity, states.texture, states.shader));
+			return;
+		}
+
+		float left = scratch[0].position.x;
+		float top = scratch[0].position.y;
+		float right = left;
+		float bottom = top;
+
+		for (const sf::Vertex& vertex : scratch)
+		{
+			left = std::min(left, vertex.position.x);
+			top = std::min(top, vertex.position.y);
+			right = std::max(right, vertex.position.x);
+			bottom = std::max(bottom, vertex.position.y);
+		}
+
+		sf::FloatRect bounds(left, top, right - left, bottom - top);
+
+		// Search for an earlier batch with the same texture, but never
+		// move the geometry below something it overlaps with
+		Batch* batch = nullptr;
+		unsigned int searched = 0;
+
+		for (std::size_t i = batchCount; i > 0 && searched < lookBehind; i--, searched++)
+		{
+			Batch& candidate = batches[i - 1];
+
+			if (candidate.texture == states.texture)
+			{
+				batch = &candidate;
+				break;
+			}
+
+			if (candidate.bounds.intersects(bounds))
+				break;
+		}
+
+		if (!batch)
+		{
+			if (batchCount == batches.size())
+				batches.emplace_back();
+
+			batch = &batches[batchCount++];
+			batch->texture = states.texture;
+			batch->bounds = bounds;
+		}
+		else
+		{
+			float batchRight = std::max(batch->bounds.left + batch->bounds.width, right);
+			float batchBottom = std::max(batch->bounds.top + batch->bounds.height, bottom);
+			batch->bounds.left = std::min(batch->bounds.left, left);
+			batch->bounds.top = std::min(batch->bounds.top, top);
+			batch->bounds.width = batchRight - batch->bounds.left;
+			batch->bounds.height = batchBottom - batch->bounds.top;
+		}
+
+		batch->vertices.insert(batch->vertices.end(), scratch.begin(), scratch.end());
+	}
+
+	void BatchRenderer::drawUnbatched(const sf::Drawable& drawable, const sf::RenderStates& states)
+	{
+		flush();
+		submit(drawable, states);
+	}
+
+	void BatchRenderer::flush()
+	{
+		for (std::size_t i = 0; i < batchCount; i++)
+		{
+			Batch& batch = batches[i];
+
+			if (!batch.vertices.empty())
+				submit(batch.vertices.data(), batch.vertices.size(), sf::Triangles, sf::RenderStates(batch.texture));
+
+			batch.vertices.clear();
+		}
+
+		batchCount = 0;
+	}
+} // namespace uie
\ No newline at end of file
@@ -1,9 +1,16 @@
 #include <UIElements/Button.hpp>
+#include <UIElements/BatchRenderer.hpp>
 
 namespace uie
 {
+	Button::Button()
+	{
+		adoptChildren();
+	}
+
 	Button::Button(const sf::Vector2f& position, const sf::Vector2f& size)
 	{
+		adoptChildren();
 		rectangle = RoundedRectangle(position, size);
 		rectangle.setFillColor(sf::Color::Color::White);
 		rectangle.setOutlineThickness(1);
@@ -43,41 +50,67 @@ namespace uie
 		
 	}
 
+	Button::Button(const Button& other)
+		: UIElement(other), rectangle(other.rectangle), text(other.text), onClick(other.onClick), style(other.style), styleVersion(other.styleVersion)
+	{
+		adoptChildren();
+	}
+
+	Button::Button(Button&& other)
+		: UIElement(std::move(other)), rectangle(std::move(other.rectangle)), text(std::move(other.text)), onClick(std::move(other.onClick)),
+		style(other.style), styleVersion(other.styleVersion)
+	{
+		adoptChildren();
+	}
+
+	void Button::adoptChildren() const
+	{
+		rectangle.setParent(this);
+		text.setParent(this);
+	}
+
 	void Button::setAttributes(const Attributes& attributes)
 	{
 		setOnClick(attributes.onClick);
 		rectangle.setAttributes(attributes.rectangleAttributes);
 		text.setAttributes(attributes.textAttributes);
+		markDirty();
 	}
 
-	RoundedRectangle& const Button::getRectangle()
+	RoundedRectangle& Button::getRectangle()
 	{
+		// Changes made through the reference have to reach the button
+		rectangle.setParent(this);
 		return rectangle;
 	}
 
 	void Button::setRectangle(const RoundedRectangle& rect)
 	{
+		// Keep the global position of the rectangle, the button may be in a moved layout
 		rectangle = rect;
+		rectangle.setPosition(rect.getPosition());
 		correctTextPosition();
 	}
 
-	Text& const Button::getText()
+	Text& Button::getText()
 	{
+		text.setParent(this);
 		return text;
 	}
 
 	void Button::setText(const Text& txt)
 	{
 		text = txt;
+		text.setPosition(txt.getPosition());
 		correctTextPosition();
 	}
 
-	const std::function<void()>& Button::getOnClick() const
+	const Callback& Button::getOnClick() const
 	{
 		return onClick;
 	}
 
-	void Button::setOnClick(const std::function<void()>& functor)
+	void Button::setOnClick(const Callback& functor)
 	{
 		onClick = functor;
 	}
@@ -88,6 +121,39 @@ namespace uie
 			onClick();
 	}
 
+	const Style* Button::getStyle() const
+	{
+		return style;
+	}
+
+	void Button::setStyle(const Style* style)
+	{
+		this->style = style;
+		styleVersion = 0;
+		applyStyles();
+	}
+
+	void Button::applyStyles()
+	{
+		if (!style)
+			return;
+
+		if (unsigned int flags = style->apply(rectangle, text, styleVersion))
+		{
+			// The text attributes may have changed the size of the text, the boundaries of the button stay the same
+			if (flags & LayoutDirty)
+				correctTextPosition();
+
+			markDirty(flags);
+		}
+	}
+
+	void Button::clicked(sf::Mouse::Button button)
+	{
+		if (button == sf::Mouse::Left)
+			executeOnClick();
+	}
+
 	sf::FloatRect Button::getLocalBounds() const
 	{
 		return rectangle.getLocalBounds();
@@ -124,6 +190,7 @@ namespace uie
 	{
 		rectangle.move(offset);
 		text.move(offset);
+		markDirty();
 	}
 
 	bool Button::intersects(const sf::Vector2f& point) const
@@ -142,6 +209,12 @@ namespace uie
 		target.draw(text, states);
 	}
 
+	void Button::batch(BatchRenderer& renderer, sf::RenderStates states) const
+	{
+		renderer.draw(rectangle, states);
+		renderer.draw(text, states);
+	}
+
 	void Button::correctTextPosition()
 	{
 		sf::FloatRect rectBounds = rectangle.getGlobalBounds();
@@ -151,6 +224,7 @@ namespace uie
 			(rectBounds.left + rectBounds.width / 2.0f) - textBounds.width / 2.0f,
 			(rectBounds.top + rectBounds.height / 2.0f) - textBounds.height / 2.0f
 		});
+		markDirty();
 	}
 
 	void Button::setString(const sf::String& string)
@@ -1,12 +1,21 @@
 #include <UIElements/Checkbox.hpp>
+#include <UIElements/BatchRenderer.hpp>
 #include <UIElements/ExtraFunctions.hpp>
+#include <UIElements/FontMetrics.hpp>
+#include <algorithm>
 #include <stdexcept>
 #include <format>
 
 namespace uie
 {
+	Checkbox::Checkbox()
+	{
+		adoptChildren();
+	}
+
 	Checkbox::Checkbox(const sf::Vector2f& position, const sf::Vector2f& size)
 	{
+		adoptChildren();
 		rectangle = RoundedRectangle(position, size);
 		rectangle.setFillColor(deselectedColor);
 		rectangle.setOutlineThickness(1);
@@ -46,6 +55,26 @@ namespace uie
 
 	}
 
+	Checkbox::Checkbox(const Checkbox& other)
+		: UIElement(other), rectangle(other.rectangle), text(other.text), selected(other.selected), selectedColor(other.selectedColor), deselectedColor(other.deselectedColor),
+		textDistance(other.textDistance), alignment(other.alignment), style(other.style), styleVersion(other.styleVersion)
+	{
+		adoptChildren();
+	}
+
+	Checkbox::Checkbox(Checkbox&& other)
+		: UIElement(std::move(other)), rectangle(std::move(other.rectangle)), text(std::move(other.text)), selected(other.selected), selectedColor(other.selectedColor),
+		deselectedColor(other.deselectedColor), textDistance(other.textDistance), alignment(other.alignment), style(other.style), styleVersion(other.styleVersion)
+	{
+		adoptChildren();
+	}
+
+	void Checkbox::adoptChildren() const
+	{
+		rectangle.setParent(this);
+		text.setParent(this);
+	}
+
 	void Checkbox::setAttributes(const Attributes& attributes)
 	{
 		attributes.selected ? select() : deselect();
@@ -55,6 +84,7 @@ namespace uie
 		textDistance = attributes.textDistance;
 		rectangle.setAttributes(attributes.rectangleAttributes);
 		text.setAttributes(attributes.textAttributes);
+		markDirty();
 	}
 
 	void Checkbox::checkAlignment()
@@ -64,25 +94,31 @@ namespace uie
 				throw std::runtime_error(std::format("Checkbox does not support alignment '{}'", toString(a)));
 	}
 
-	RoundedRectangle& const Checkbox::getRectangle()
+	RoundedRectangle& Checkbox::getRectangle()
 	{
+		// Changes made through the reference have to reach the checkbox
+		rectangle.setParent(this);
 		return rectangle;
 	}
 
 	void Checkbox::setRectangle(const RoundedRectangle& rect)
 	{
+		// Keep the global position of the rectangle, the checkbox may be in a moved layout
 		rectangle = rect;
+		rectangle.setPosition(rect.getPosition());
 		correctTextPosition();
 	}
 
-	Text& const Checkbox::getText()
+	Text& Checkbox::getText()
 	{
+		text.setParent(this);
 		return text;
 	}
 
 	void Checkbox::setText(const Text& txt)
 	{
 		text = txt;
+		text.setPosition(txt.getPosition());
 		correctTextPosition();
 	}
 
@@ -95,12 +131,14 @@ namespace uie
 	{
 		selected = true;
 		rectangle.setFillColor(selectedColor);
+		markDirty(PaintDirty);
 	}
 
 	void Checkbox::deselect()
 	{
 		selected = false;
 		rectangle.setFillColor(deselectedColor);
+		markDirty(PaintDirty);
 	}
 
 	void Checkbox::toggle()
@@ -108,14 +146,50 @@ namespace uie
 		selected ? deselect() : select();
 	}
 
+	const Style* Checkbox::getStyle() const
+	{
+		return style;
+	}
+
+	void Checkbox::setStyle(const Style* style)
+	{
+		this->style = style;
+		styleVersion = 0;
+		applyStyles();
+	}
+
+	void Checkbox::applyStyles()
+	{
+		if (!style)
+			return;
+
+		if (unsigned int flags = style->apply(rectangle, text, styleVersion))
+		{
+			// The fill color shows the state, not the style
+			rectangle.setFillColor(selected ? selectedColor : deselectedColor);
+
+			// The text attributes may have changed the size of the text, the boundaries of the checkbox stay the same
+			if (flags & LayoutDirty)
+				correctTextPosition();
+
+			markDirty(flags);
+		}
+	}
+
+	void Checkbox::clicked(sf::Mouse::Button button)
+	{
+		if (button == sf::Mouse::Left)
+			toggle();
+	}
+
 	sf::FloatRect Checkbox::getLocalBounds() const
 	{
-		return getTotalRect<float>({ rectangle.getLocalBounds(), text.getLocalBounds() });
+		return getTotalRect(rectangle.getLocalBounds(), text.getLocalBounds());
 	}
 
 	sf::FloatRect Checkbox::getGlobalBounds() const
 	{
-		return getTotalRect<float>({ rectangle.getGlobalBounds(), text.getGlobalBounds() });
+		return getTotalRect(rectangle.getGlobalBounds(), text.getGlobalBounds());
 	}
 
 	sf::Vector2f Checkbox::getPosition() const
@@ -144,6 +218,7 @@ namespace uie
 	{
 		rectangle.move(offset);
 		text.move(offset);
+		markDirty();
 	}
 
 	bool Checkbox::intersects(const sf::Vector2f& point) const
@@ -162,26 +237,38 @@ namespace uie
 		target.draw(text, states);
 	}
 
+	void Checkbox::batch(BatchRenderer& renderer, sf::RenderStates states) const
+	{
+		renderer.draw(rectangle, states);
+		renderer.draw(text, states);
+	}
+
 	void Checkbox::correctTextPosition()
 	{
 		checkAlignment();
+		markDirty();
 
-		const sf::String txt = text.getString();
+		const sf::String& txt = text.getString();
 
-		if (txt.getSize() == 0)
+		if (txt.isEmpty())
 			return;
 
 		sf::Vector2f textSize = text.getSize();
-		float textHeight = textSize.y;
-
-		if (txt.find('\n') == sf::String::InvalidPos)
-			textHeight = Text({ 0, 0 }, txt[0], text.getCharacterSize(), *text.getFont()).getSize().y;
-
 		sf::FloatRect rectBounds = rectangle.getGlobalBounds();
 		sf::Vector2f rectPosition = rectBounds.getPosition();
 		sf::Vector2f rectSize = rectBounds.getSize();
 
-		float y = rectPosition.y + (rectSize.y / 2.0f - textHeight / 2.0f);
+		float y = rectPosition.y + (rectSize.y / 2.0f - textSize.y / 2.0f);
+
+		// A single line centers its capitals, using the cached font metrics instead of measuring a glyph
+		if (text.getFont() && std::find(txt.begin(), txt.end(), '\n') == txt.end())
+		{
+			const FontMetrics& metrics = getFontMetrics(*text.getFont(), text.getCharacterSize(), text.getStyle());
+
+			// The first baseline lies one character size below the top of the line, the position is the top of the glyphs
+			float baseline = text.getCharacterSize() - text.getLocalBounds().top;
+			y = rectPosition.y + rectSize.y / 2.0f + metrics.ascent / 2.0f - baseline;
+		}
 
 		if (alignment & Left)
 			text.setPosition({ rectPosition.x - textSize.x - textDistance, y });
@@ -200,6 +287,8 @@ namespace uie
 
 		if (selected)
 			rectangle.setFillColor(selectedColor);
+
+		markDirty(PaintDirty);
 	}
 
 	const sf::Color& Checkbox::getDeselectedColor() const
@@ -213,6 +302,8 @@ namespace uie
 
 		if (!selected)
 			rectangle.setFillColor(deselectedColor);
+
+		markDirty(PaintDirty);
 	}
 
 	Alignment Checkbox::getTextAlignment() const
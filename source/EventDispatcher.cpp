@@ -0,0 +1,142 @@
+#include <UIElements/EventDispatcher.hpp>
+
+namespace uie
+{
+	EventDispatcher::EventDispatcher(UIElement& root)
+		: root(root)
+	{
+
+	}
+
+	UIElement* EventDispatcher::find(const sf::Vector2f& point)
+	{
+		// Nothing moved since the last search, so the last hit only has to be checked
+		if (lastHit && lastHitGeneration == UIElement::getLayoutGeneration())
+			if (lastHit->hitTest(point - lastHitOffset) == lastHit)
+				return lastHit;
+
+		searchCount++;
+
+		sf::Vector2f localPoint;
+		lastHit = root.hitTest(point, &localPoint);
+		lastHitOffset = point - localPoint;
+		lastHitGeneration = UIElement::getLayoutGeneration();
+
+		return lastHit;
+	}
+
+	void EventDispatcher::setHovered(UIElement* element)
+	{
+		if (element == hovered)
+			return;
+
+		if (hovered)
+			hovered->mouseLeft();
+
+		hovered = element;
+
+		if (hovered)
+			hovered->mouseEntered();
+	}
+
+	UIElement& EventDispatcher::getRoot() const
+	{
+		return root;
+	}
+
+	UIElement* EventDispatcher::getHovered() const
+	{
+		return hovered;
+	}
+
+	UIElement* EventDispatcher::getPressed() const
+	{
+		return pressed;
+	}
+
+	std::size_t EventDispatcher::getSearchCount() const
+	{
+		return searchCount;
+	}
+
+	void EventDispatcher::reset()
+	{
+		hovered = nullptr;
+		pressed = nullptr;
+		lastHit = nullptr;
+	}
+
+	bool EventDispatcher::dispatch(const sf::Event& event, const sf::Vector2f& point)
+	{
+		switch (event.type)
+		{
+		case sf::Event::MouseMoved:
+		{
+			UIElement* hit = find(point);
+			setHovered(hit);
+			return hit;
+		}
+		case sf::Event::MouseButtonPressed:
+		{
+			UIElement* hit = find(point);
+			setHovered(hit);
+
+			pressed = hit;
+			pressedButton = event.mouseButton.button;
+
+			if (hit)
+				hit->mousePressed(event.mouseButton.button);
+
+			return hit;
+		}
+		case sf::Event::MouseButtonReleased:
+		{
+			UIElement* hit = find(point);
+			setHovered(hit);
+
+			if (hit)
+			{
+				hit->mouseReleased(event.mouseButton.button);
+
+				// Only a release on the ui-element the button was pressed on is a click
+				if (hit == pressed && event.mouseButton.button == pressedButton)
+					hit->clicked(event.mouseButton.button);
+			}
+
+			if (event.mouseButton.button == pressedButton)
+				pressed = nullptr;
+
+			return hit;
+		}
+		case sf::Event::MouseLeft:
+			setHovered(nullptr);
+			return false;
+		default:
+			return false;
+		}
+	}
+
+	bool EventDispatcher::handleEvent(const sf::Event& event)
+	{
+		sf::Vector2i pixel;
+
+		if (event.type == sf::Event::MouseMoved)
+			pixel = { event.mouseMove.x, event.mouseMove.y };
+		else if (event.type == sf::Event::MouseButtonPressed || event.type == sf::Event::MouseButtonReleased)
+			pixel = { event.mouseButton.x, event.mouseButton.y };
+
+		return dispatch(event, sf::Vector2f(pixel));
+	}
+
+	bool EventDispatcher::handleEvent(const sf::Event& event, const sf::RenderTarget& target)
+	{
+		sf::Vector2i pixel;
+
+		if (event.type == sf::Event::MouseMoved)
+			pixel = { event.mouseMove.x, event.mouseMove.y };
+		else if (event.type == sf::Event::MouseButtonPressed || event.type == sf::Event::MouseButtonReleased)
+			pixel = { event.mouseButton.x, event.mouseButton.y };
+
+		return dispatch(event, target.mapPixelToCoords(pixel));
+	}
+} // namespace uie
\ No newline at end of file
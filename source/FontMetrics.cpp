@@ -0,0 +1,51 @@
+#include <UIElements/FontMetrics.hpp>
+#include <unordered_map>
+#include <cstdint>
+
+namespace
+{
+	struct Key
+	{
+		const sf::Font* font;
+		unsigned int characterSize;
+		bool bold;
+
+		bool operator==(const Key& other) const = default;
+	};
+
+	struct KeyHash
+	{
+		std::size_t operator()(const Key& key) const
+		{
+			std::size_t hash = std::hash<const sf::Font*>()(key.font);
+			return hash ^ (static_cast<std::size_t>(key.characterSize) << 1 | key.bold) * 0x9e3779b97f4a7c15ull;
+		}
+	};
+
+	std::unordered_map<Key, uie::FontMetrics, KeyHash> cache;	// The metrics of every font, character size and style asked for
+} // namespace
+
+namespace uie
+{
+	const FontMetrics& getFontMetrics(const sf::Font& font, unsigned int characterSize, unsigned int style)
+	{
+		bool bold = style & sf::Text::Bold;
+		auto [it, inserted] = cache.try_emplace({ &font, characterSize, bold });
+
+		if (inserted)
+		{
+			// Glyph bounds are relative to the baseline, with y pointing down
+			it->second.ascent = -font.getGlyph(U'H', characterSize, bold).bounds.top;
+			sf::FloatRect descender = font.getGlyph(U'g', characterSize, bold).bounds;
+			it->second.descent = descender.top + descender.height;
+			it->second.lineHeight = font.getLineSpacing(characterSize);
+		}
+
+		return it->second;
+	}
+
+	void clearFontMetrics(const sf::Font& font)
+	{
+		std::erase_if(cache, [&](const auto& entry) { return entry.first.font == &font; });
+	}
+} // namespace uie
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include <UIElements/RenderCache.hpp>
+#include <UIElements/BatchRenderer.hpp>
+#include <cmath>
+
+namespace
+{
+	// The contents are rendered with alpha blending on a transparent texture,
+	// which leaves the colors multiplied by their alpha
+	const sf::BlendMode BlendPremultipliedAlpha(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+} // namespace
+
+namespace uie
+{
+	RenderCache::RenderCache(const RenderCache& other)
+		: enabled(other.enabled)
+	{
+
+	}
+
+	RenderCache& RenderCache::operator=(const RenderCache& other)
+	{
+		enabled = other.enabled;
+		valid = false;
+
+		if (!enabled)
+			texture.reset();
+
+		return *this;
+	}
+
+	void RenderCache::makeQuad(sf::Vertex* quad, const sf::Vector2f& position) const
+	{
+		sf::Vector2f size(texture->getSize());
+
+		quad[0] = sf::Vertex(position, { 0, 0 });
+		quad[1] = sf::Vertex({ position.x + size.x, position.y }, { size.x, 0 });
+		quad[2] = sf::Vertex({ position.x, position.y + size.y }, { 0, size.y });
+		quad[3] = sf::Vertex(position + size, size);
+	}
+
+	bool RenderCache::isEnabled() const
+	{
+		return enabled;
+	}
+
+	void RenderCache::setEnabled(bool enabled)
+	{
+		this->enabled = enabled;
+		valid = false;
+
+		if (!enabled)
+			texture.reset();
+	}
+
+	void RenderCache::invalidate()
+	{
+		valid = false;
+	}
+
+	bool RenderCache::needsUpdate(const sf::FloatRect& area) const
+	{
+		return !valid || area.getSize() != bounds.getSize();
+	}
+
+	sf::RenderTarget* RenderCache::begin(const sf::FloatRect& area)
+	{
+		valid = false;
+
+		sf::Vector2u size(
+			static_cast<unsigned int>(std::ceil(area.width)),
+			static_cast<unsigned int>(std::ceil(area.height))
+		);
+
+		if (size.x == 0 || size.y == 0)
+			return nullptr;
+
+		if (!texture)
+			texture = std::make_unique<sf::RenderTexture>();
+
+		if (texture->getSize() != size && !texture->create(size.x, size.y))
+		{
+			texture.reset();
+			return nullptr;
+		}
+
+		bounds = area;
+
+		texture->setView(sf::View({ area.left, area.top, static_cast<float>(size.x), static_cast<float>(size.y) }));
+		texture->clear(sf::Color::Transparent);
+
+		return texture.get();
+	}
+
+	void RenderCache::end()
+	{
+		texture->display();
+		valid = true;
+	}
+
+	void RenderCache::draw(sf::RenderTarget& target, sf::RenderStates states, const sf::Vector2f& position) const
+	{
+		if (!texture)
+			return;
+
+		sf::Vertex quad[4];
+		makeQuad(quad, position);
+
+		states.texture = &texture->getTexture();
+		states.blendMode = BlendPremultipliedAlpha;
+		target.draw(quad, 4, sf::TriangleStrip, states);
+	}
+
+	void RenderCache::batch(BatchRenderer& renderer, sf::RenderStates states, const sf::Vector2f& position) const
+	{
+		if (!texture)
+			return;
+
+		sf::Vertex quad[4];
+		makeQuad(quad, position);
+
+		states.texture = &texture->getTexture();
+		states.blendMode = BlendPremultipliedAlpha;
+		renderer.append(quad, 4, sf::TriangleStrip, states);
+	}
+} // namespace uie
\ No newline at end of file
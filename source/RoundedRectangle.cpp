@@ -1,9 +1,19 @@
 #include <UIElements/RoundedRectangle.hpp>
+#include <UIElements/BatchRenderer.hpp>
+#include <UIElements/ExtraFunctions.hpp>
 #include <stdexcept>
+#include <algorithm>
+#include <cmath>
 
 namespace uie
 {
+	RoundedRectangle::RoundedRectangle()
+	{
+		rectangle.setUpdateDeferred(true);
+	}
+
 	RoundedRectangle::RoundedRectangle(const sf::Vector2f& position, const sf::Vector2f& size)
+		: RoundedRectangle()
 	{
 		rectangle.setPosition(position);
 		rectangle.setSize(size);
@@ -40,6 +50,104 @@ namespace uie
 		setOutlineThickness(attributes.outlineThickness);
 	}
 
+	void RoundedRectangle::ensureGeometryUpdate() const
+	{
+		if (!geometryNeedUpdate)
+			return;
+
+		geometryNeedUpdate = false;
+
+		std::size_t count = rectangle.getPointCount();
+
+		if (count < 3)
+		{
+			fillVertices.clear();
+			outlineVertices.clear();
+			return;
+		}
+
+		// Fill, a triangle fan around the center of the shape
+		fillVertices.resize(count + 2);
+
+		for (std::size_t i = 0; i < count; i++)
+			fillVertices[i + 1] = sf::Vertex(rectangle.getPoint(i));
+
+		fillVertices[count + 1] = fillVertices[1];
+
+		float left = fillVertices[1].position.x;
+		float top = fillVertices[1].position.y;
+		float right = left;
+		float bottom = top;
+
+		for (std::size_t i = 2; i <= count; i++)
+		{
+			const sf::Vector2f& point = fillVertices[i].position;
+			left = std::min(left, point.x);
+			top = std::min(top, point.y);
+			right = std::max(right, point.x);
+			bottom = std::max(bottom, point.y);
+		}
+
+		fillVertices[0] = sf::Vertex({ (left + right) / 2.0f, (top + bottom) / 2.0f });
+
+		sf::FloatRect textureRect(rectangle.getTextureRect());
+		float width = right - left;
+		float height = bottom - top;
+
+		for (sf::Vertex& vertex : fillVertices)
+		{
+			float xRatio = width > 0 ? (vertex.position.x - left) / width : 0;
+			float yRatio = height > 0 ? (vertex.position.y - top) / height : 0;
+			vertex.texCoords = { textureRect.left + textureRect.width * xRatio, textureRect.top + textureRect.height * yRatio };
+		}
+
+		// Outline, a triangle strip alternating between the inner and outer edge
+		float thickness = rectangle.getOutlineThickness();
+
+		if (thickness == 0)
+		{
+			outlineVertices.clear();
+			return;
+		}
+
+		auto computeNormal = [](const sf::Vector2f& p1, const sf::Vector2f& p2)
+		{
+			sf::Vector2f normal(p1.y - p2.y, p2.x - p1.x);
+			float length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+			return length != 0 ? normal / length : normal;
+		};
+
+		const sf::Vector2f& center = fillVertices[0].position;
+		outlineVertices.resize((count + 1) * 2);
+
+		for (std::size_t i = 0; i < count; i++)
+		{
+			std::size_t index = i + 1;
+
+			const sf::Vector2f& p0 = (i == 0) ? fillVertices[count].position : fillVertices[index - 1].position;
+			const sf::Vector2f& p1 = fillVertices[index].position;
+			const sf::Vector2f& p2 = fillVertices[index + 1].position;
+
+			sf::Vector2f n1 = computeNormal(p0, p1);
+			sf::Vector2f n2 = computeNormal(p1, p2);
+
+			// Make sure the normals point towards the outside of the shape
+			if (n1.x * (center.x - p1.x) + n1.y * (center.y - p1.y) > 0)
+				n1 = -n1;
+			if (n2.x * (center.x - p1.x) + n2.y * (center.y - p1.y) > 0)
+				n2 = -n2;
+
+			float factor = 1.0f + (n1.x * n2.x + n1.y * n2.y);
+			sf::Vector2f normal = (n1 + n2) / factor;
+
+			outlineVertices[i * 2] = sf::Vertex(p1);
+			outlineVertices[i * 2 + 1] = sf::Vertex(p1 + normal * thickness);
+		}
+
+		outlineVertices[count * 2] = outlineVertices[0];
+		outlineVertices[count * 2 + 1] = outlineVertices[1];
+	}
+
 	sf::FloatRect RoundedRectangle::getLocalBounds() const
 	{
 		return rectangle.getLocalBounds();
@@ -47,17 +155,19 @@ namespace uie
 
 	sf::FloatRect RoundedRectangle::getGlobalBounds() const
 	{
-		return rectangle.getGlobalBounds();
+		sf::FloatRect bounds = rectangle.getGlobalBounds();
+		return { bounds.getPosition() + getParentOffset(), bounds.getSize() };
 	}
 
 	sf::Vector2f RoundedRectangle::getPosition() const
 	{
-		return rectangle.getPosition();
+		return rectangle.getPosition() + getParentOffset();
 	}
 
 	void RoundedRectangle::setPosition(const sf::Vector2f& position)
 	{
-		rectangle.setPosition(position);
+		rectangle.setPosition(position - getParentOffset());
+		markDirty();
 	}
 
 	sf::Vector2f RoundedRectangle::getSize() const
@@ -68,16 +178,30 @@ namespace uie
 	void RoundedRectangle::setSize(const sf::Vector2f& size)
 	{
 		rectangle.setSize(size);
+		geometryNeedUpdate = true;
+		markDirty();
 	}
 
 	void RoundedRectangle::move(const sf::Vector2f& offset)
 	{
 		rectangle.move(offset);
+		markDirty();
+	}
+
+	float RoundedRectangle::getOuterRadius() const
+	{
+		// An outline on the outside rounds the outer corners with a larger radius
+		return rectangle.getCornersRadius() + std::max(rectangle.getOutlineThickness(), 0.0f);
 	}
 
 	bool RoundedRectangle::intersects(const sf::Vector2f& point) const
 	{
-		return getGlobalBounds().intersects({ point, {1, 1} });
+		return roundedRectContains(getCachedGlobalBounds(), getOuterRadius(), point);
+	}
+
+	void RoundedRectangle::intersects(std::span<const sf::Vector2f> points, std::span<std::uint8_t> results) const
+	{
+		roundedRectContains(getCachedGlobalBounds(), getOuterRadius(), points, results);
 	}
 
 	bool RoundedRectangle::intersects(const sf::FloatRect& rect) const
@@ -87,9 +211,34 @@ namespace uie
 
 	void RoundedRectangle::draw(sf::RenderTarget& target, sf::RenderStates states) const
 	{
+		rectangle.ensureUpdate();
 		target.draw(rectangle, states);
 	}
 
+	void RoundedRectangle::batch(BatchRenderer& renderer, sf::RenderStates states) const
+	{
+		ensureGeometryUpdate();
+
+		states.transform *= rectangle.getTransform();
+
+		const sf::Color& fillColor = rectangle.getFillColor();
+		const sf::Color& outlineColor = rectangle.getOutlineColor();
+
+		// Fully transparent geometry does not change the result, so skip it
+		if (fillColor.a != 0)
+		{
+			sf::RenderStates fillStates(states);
+			fillStates.texture = rectangle.getTexture();
+			renderer.append(fillVertices.data(), fillVertices.size(), sf::TriangleFan, fillStates, fillColor);
+		}
+
+		if (outlineColor.a != 0 && !outlineVertices.empty())
+		{
+			states.texture = nullptr;
+			renderer.append(outlineVertices.data(), outlineVertices.size(), sf::TriangleStrip, states, outlineColor);
+		}
+	}
+
 	float RoundedRectangle::getCornersRadius() const
 	{
 		return rectangle.getCornersRadius();
@@ -98,11 +247,13 @@ namespace uie
 	void RoundedRectangle::setCornersRadius(float radius)
 	{
 		rectangle.setCornersRadius(radius);
+		geometryNeedUpdate = true;
+		markDirty(PaintDirty);
 	}
 
 	unsigned int RoundedRectangle::getCornerPointCount() const
 	{
-		return rectangle.getPointCount() / 4;
+		return rectangle.getCornerPointCount();
 	}
 
 	void RoundedRectangle::setCornerPointCount(unsigned int count)
@@ -111,6 +262,8 @@ namespace uie
 			throw std::invalid_argument("Point count must be greater than 1");
 
 		rectangle.setCornerPointCount(count);
+		geometryNeedUpdate = true;
+		markDirty(PaintDirty);
 	}
 
 	const sf::Texture* RoundedRectangle::getTexture() const
@@ -121,6 +274,8 @@ namespace uie
 	void RoundedRectangle::setTexture(const sf::Texture* texture, bool resetRect)
 	{
 		rectangle.setTexture(texture, resetRect);
+		geometryNeedUpdate = true;
+		markDirty(PaintDirty);
 	}
 
 	const sf::IntRect& RoundedRectangle::getTextureRect() const
@@ -131,6 +286,8 @@ namespace uie
 	void RoundedRectangle::setTextureRect(const sf::IntRect& rect)
 	{
 		rectangle.setTextureRect(rect);
+		geometryNeedUpdate = true;
+		markDirty(PaintDirty);
 	}
 
 	const sf::Color& RoundedRectangle::getFillColor() const
@@ -141,6 +298,7 @@ namespace uie
 	void RoundedRectangle::setFillColor(const sf::Color& color)
 	{
 		rectangle.setFillColor(color);
+		markDirty(PaintDirty);
 	}
 
 	const sf::Color& RoundedRectangle::getOutlineColor() const
@@ -151,6 +309,7 @@ namespace uie
 	void RoundedRectangle::setOutlineColor(const sf::Color& color)
 	{
 		rectangle.setOutlineColor(color);
+		markDirty(PaintDirty);
 	}
 
 	float RoundedRectangle::getOutlineThickness() const
@@ -161,6 +320,8 @@ namespace uie
 	void RoundedRectangle::setOutlineThickness(float thickness)
 	{
 		rectangle.setOutlineThickness(thickness);
+		geometryNeedUpdate = true;
+		markDirty();
 	}
 
 	void RoundedRectangle::makeRectangle()
@@ -23,24 +23,68 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/RoundedRectangleShape.hpp>
+#include <atomic>
 #include <cmath>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // Number of geometry rebuilds of all the shapes, see getTessellationCount
+    ////////////////////////////////////////////////////////////
+    std::atomic<std::size_t> tessellationCount(0);
+
+    ////////////////////////////////////////////////////////////
+    // Get the unit circle offsets of all the points for a corner point count.
+    // The offsets only depend on the point count, so they are computed once and
+    // shared by every shape, which leaves a multiply-add per point in getPoint.
+    ////////////////////////////////////////////////////////////
+    const sf::Vector2f* getCornerOffsets(unsigned int cornerPointCount)
+    {
+        static std::map<unsigned int, std::vector<sf::Vector2f>> tables;
+        static std::mutex mutex;
+        static const float pi = 3.141592654f;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<sf::Vector2f>& offsets = tables[cornerPointCount];
+
+        if (offsets.empty() && cornerPointCount > 0)
+        {
+            float deltaAngle = 90.0f / (cornerPointCount - 1);
+            offsets.resize(cornerPointCount * 4);
+
+            for (std::size_t index = 0; index < offsets.size(); index++)
+            {
+                unsigned int centerIndex = index / cornerPointCount;
+                float angle = deltaAngle * (index - centerIndex) * pi / 180;
+                offsets[index] = sf::Vector2f(cos(angle), -sin(angle));
+            }
+        }
+
+        return offsets.data();
+    }
+} // namespace
 
 namespace sf
 {
     ////////////////////////////////////////////////////////////
     RoundedRectangleShape::RoundedRectangleShape(const Vector2f& size, float radius, unsigned int cornerPointCount)
+        : myUpdateDeferred(false), myNeedsUpdate(false), mySuspended(false)
     {
         mySize = size;
         myRadius = radius;
         myCornerPointCount = cornerPointCount;
-        update();
+        myCornerOffsets = getCornerOffsets(cornerPointCount);
+        tessellate();
     }
 
     ////////////////////////////////////////////////////////////
     void RoundedRectangleShape::setSize(const Vector2f& size)
     {
         mySize = size;
-        update();
+        requestUpdate();
     }
 
     ////////////////////////////////////////////////////////////
@@ -53,7 +97,7 @@ namespace sf
     void RoundedRectangleShape::setCornersRadius(float radius)
     {
         myRadius = radius;
-        update();
+        requestUpdate();
     }
 
     ////////////////////////////////////////////////////////////
@@ -66,13 +110,116 @@ namespace sf
     void RoundedRectangleShape::setCornerPointCount(unsigned int count)
     {
         myCornerPointCount = count;
+        myCornerOffsets = getCornerOffsets(count);
+        requestUpdate();
+    }
+
+    ////////////////////////////////////////////////////////////
+    unsigned int RoundedRectangleShape::getCornerPointCount() const
+    {
+        return myCornerPointCount;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void RoundedRectangleShape::setOutlineThickness(float thickness)
+    {
+        if (!myUpdateDeferred)
+        {
+            if (getPointCount() > 0)
+                tessellationCount++;
+
+            Shape::setOutlineThickness(thickness);
+            return;
+        }
+
+        // sf::Shape rebuilds the geometry when the thickness changes,
+        // so let it rebuild an empty shape and rebuild the real one later
+        mySuspended = true;
+        Shape::setOutlineThickness(thickness);
+        mySuspended = false;
+
+        myNeedsUpdate = true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void RoundedRectangleShape::setUpdateDeferred(bool deferred)
+    {
+        myUpdateDeferred = deferred;
+
+        if (!deferred)
+            ensureUpdate();
+    }
+
+    ////////////////////////////////////////////////////////////
+    bool RoundedRectangleShape::isUpdateDeferred() const
+    {
+        return myUpdateDeferred;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void RoundedRectangleShape::ensureUpdate() const
+    {
+        if (!myNeedsUpdate)
+            return;
+
+        myNeedsUpdate = false;
+        const_cast<RoundedRectangleShape*>(this)->tessellate();
+    }
+
+    ////////////////////////////////////////////////////////////
+    FloatRect RoundedRectangleShape::getLocalBounds() const
+    {
+        ensureUpdate();
+        return Shape::getLocalBounds();
+    }
+
+    ////////////////////////////////////////////////////////////
+    FloatRect RoundedRectangleShape::getGlobalBounds() const
+    {
+        ensureUpdate();
+        return Shape::getGlobalBounds();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void RoundedRectangleShape::requestUpdate()
+    {
+        if (!myUpdateDeferred)
+        {
+            tessellate();
+            return;
+        }
+
+        if (myNeedsUpdate)
+            return;
+
+        // Empty the geometry, so the outline, texture and color setters
+        // called before the rebuild have nothing to update
+        mySuspended = true;
+        update();
+        mySuspended = false;
+
+        myNeedsUpdate = true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::size_t RoundedRectangleShape::getTessellationCount()
+    {
+        return tessellationCount;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void RoundedRectangleShape::tessellate()
+    {
+        if (getPointCount() > 0)
+            tessellationCount++;
+
         update();
     }
 
     ////////////////////////////////////////////////////////////
     std::size_t RoundedRectangleShape::getPointCount() const
     {
-        return myCornerPointCount * 4;
+        return mySuspended ? 0 : myCornerPointCount * 4;
     }
 
     ////////////////////////////////////////////////////////////
@@ -81,10 +228,8 @@ namespace sf
         if (index >= myCornerPointCount * 4)
             return sf::Vector2f(0, 0);
 
-        float deltaAngle = 90.0f / (myCornerPointCount - 1);
         sf::Vector2f center;
         unsigned int centerIndex = index / myCornerPointCount;
-        static const float pi = 3.141592654f;
 
         switch (centerIndex)
         {
@@ -94,7 +239,6 @@ namespace sf
         case 3: center.x = mySize.x - myRadius; center.y = mySize.y - myRadius; break;
         }
 
-        return sf::Vector2f(myRadius * cos(deltaAngle * (index - centerIndex) * pi / 180) + center.x,
-            -myRadius * sin(deltaAngle * (index - centerIndex) * pi / 180) + center.y);
+        return myCornerOffsets[index] * myRadius + center;
     }
 } // namespace sf
\ No newline at end of file
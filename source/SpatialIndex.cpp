@@ -0,0 +1,160 @@
+#include <UIElements/SpatialIndex.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace uie
+{
+	std::uint64_t SpatialIndex::getKey(std::int32_t x, std::int32_t y)
+	{
+		return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+	}
+
+	std::int32_t SpatialIndex::getCell(float coordinate) const
+	{
+		// Clamped, so huge or infinite rectangles can not overflow the cell coordinates
+		const float limit = 1 << 30;
+		return static_cast<std::int32_t>(std::clamp(std::floor(coordinate / cellSize), -limit, limit));
+	}
+
+	SpatialIndex::SpatialIndex(float cellSize)
+		: cellSize(cellSize > 0 ? cellSize : 1)
+	{
+
+	}
+
+	float SpatialIndex::getCellSize() const
+	{
+		return cellSize;
+	}
+
+	void SpatialIndex::reset(float cellSize)
+	{
+		clear();
+		this->cellSize = cellSize > 0 ? cellSize : 1;
+	}
+
+	void SpatialIndex::clear()
+	{
+		cells.clear();
+		rects.clear();
+		used.clear();
+		count = 0;
+	}
+
+	std::size_t SpatialIndex::size() const
+	{
+		return count;
+	}
+
+	bool SpatialIndex::contains(std::size_t id) const
+	{
+		return id < used.size() && used[id];
+	}
+
+	void SpatialIndex::insert(std::size_t id, const sf::FloatRect& rect)
+	{
+		if (contains(id))
+		{
+			// Unchanged cells keep the id, only the difference has to be updated
+			if (getCell(rects[id].left) == getCell(rect.left) && getCell(rects[id].top) == getCell(rect.top) &&
+				getCell(rects[id].left + rects[id].width) == getCell(rect.left + rect.width) &&
+				getCell(rects[id].top + rects[id].height) == getCell(rect.top + rect.height))
+			{
+				rects[id] = rect;
+				return;
+			}
+
+			remove(id);
+		}
+
+		if (id >= rects.size())
+		{
+			rects.resize(id + 1);
+			used.resize(id + 1);
+		}
+
+		rects[id] = rect;
+		used[id] = true;
+		count++;
+
+		forEachCell(rect, [&](std::uint64_t key)
+		{
+			cells[key].push_back(id);
+		});
+	}
+
+	void SpatialIndex::remove(std::size_t id)
+	{
+		if (!contains(id))
+			return;
+
+		forEachCell(rects[id], [&](std::uint64_t key)
+		{
+			auto cell = cells.find(key);
+
+			if (cell == cells.end())
+				return;
+
+			std::vector<std::size_t>& ids = cell->second;
+			ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+
+			if (ids.empty())
+				cells.erase(cell);
+		});
+
+		used[id] = false;
+		count--;
+	}
+
+	void SpatialIndex::query(const sf::Vector2f& point, std::vector<std::size_t>& ids) const
+	{
+		ids.clear();
+
+		auto cell = cells.find(getKey(getCell(point.x), getCell(point.y)));
+
+		if (cell == cells.end())
+			return;
+
+		for (std::size_t id : cell->second)
+			if (rects[id].contains(point))
+				ids.push_back(id);
+
+		std::sort(ids.begin(), ids.end());
+	}
+
+	void SpatialIndex::query(const sf::FloatRect& rect, std::vector<std::size_t>& ids) const
+	{
+		ids.clear();
+
+		auto addCell = [&](const std::vector<std::size_t>& cell)
+		{
+			for (std::size_t id : cell)
+				if (rects[id].intersects(rect))
+					ids.push_back(id);
+		};
+
+		// A rectangle covering more cells than are in use is faster to answer by visiting every used cell
+		double columns = static_cast<double>(getCell(rect.left + rect.width)) - getCell(rect.left) + 1;
+		double rows = static_cast<double>(getCell(rect.top + rect.height)) - getCell(rect.top) + 1;
+
+		if (columns * rows > cells.size())
+		{
+			for (const auto& [key, cell] : cells)
+				addCell(cell);
+		}
+		else
+		{
+			forEachCell(rect, [&](std::uint64_t key)
+			{
+				auto cell = cells.find(key);
+
+				if (cell != cells.end())
+					addCell(cell->second);
+			});
+		}
+
+		// A rectangle spanning multiple cells is found once per cell
+		std::sort(ids.begin(), ids.end());
+		ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+	}
+} // namespace uie
\ No newline at end of file
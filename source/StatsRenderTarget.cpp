@@ -0,0 +1,160 @@
+#include <UIElements/StatsRenderTarget.hpp>
+#include <typeinfo>
+
+namespace
+{
+	std::size_t getPrimitiveCount(std::size_t vertexCount, sf::PrimitiveType type)
+	{
+		switch (type)
+		{
+		case sf::Points:
+			return vertexCount;
+		case sf::Lines:
+			return vertexCount / 2;
+		case sf::LineStrip:
+			return vertexCount > 0 ? vertexCount - 1 : 0;
+		case sf::Triangles:
+			return vertexCount / 3;
+		case sf::TriangleStrip:
+		case sf::TriangleFan:
+			return vertexCount > 1 ? vertexCount - 2 : 0;
+		default:
+			return 0;
+		}
+	}
+} // namespace
+
+namespace uie
+{
+	void RenderStats::reset()
+	{
+		*this = RenderStats();
+	}
+
+	std::map<std::string, RenderStats::ElementStats> RenderStats::getElementTypesByName() const
+	{
+		std::map<std::string, ElementStats> names;
+
+		for (const auto& [type, elementStats] : elementTypes)
+			names[type.name()] = elementStats;
+
+		return names;
+	}
+
+	StatsRenderTarget::NullTarget::NullTarget(const sf::Vector2u& size)
+		: size(size)
+	{
+		initialize();
+	}
+
+	sf::Vector2u StatsRenderTarget::NullTarget::getSize() const
+	{
+		return size;
+	}
+
+	bool StatsRenderTarget::NullTarget::setActive(bool /*active*/)
+	{
+		// Never activating a context makes every draw call a no-op
+		return false;
+	}
+
+	StatsRenderTarget::StatsRenderTarget(std::unique_ptr<NullTarget> target)
+		: BatchRenderer(*target), nullTarget(std::move(target))
+	{
+
+	}
+
+	StatsRenderTarget::StatsRenderTarget(const sf::Vector2u& size)
+		: StatsRenderTarget(std::make_unique<NullTarget>(size))
+	{
+
+	}
+
+	StatsRenderTarget::StatsRenderTarget(sf::RenderTarget& target)
+		: BatchRenderer(target)
+	{
+
+	}
+
+	StatsRenderTarget::~StatsRenderTarget()
+	{
+		// The null target is gone by the time the base class flushes
+		flush();
+	}
+
+	void StatsRenderTarget::countDrawCall(const sf::Texture* texture, bool hasTexture)
+	{
+		stats.drawCalls++;
+
+		if (!hasTexture || !hasLastTexture || texture != lastTexture)
+			stats.textureBinds++;
+
+		lastTexture = texture;
+		hasLastTexture = hasTexture;
+	}
+
+	void StatsRenderTarget::submit(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states)
+	{
+		countDrawCall(states.texture, true);
+		stats.primitives += getPrimitiveCount(vertexCount, type);
+		stats.vertices += vertexCount;
+
+		if (nullTarget)
+			return;
+
+		BatchRenderer::submit(vertices, vertexCount, type, states);
+	}
+
+	void StatsRenderTarget::submit(const sf::Drawable& drawable, const sf::RenderStates& states)
+	{
+		// The geometry of the drawable is unknown, so is the texture it binds
+		countDrawCall(nullptr, false);
+		stats.unbatchedDraws++;
+
+		if (!drawing.empty())
+			drawing.back()->appends++;
+
+		if (nullTarget)
+			return;
+
+		BatchRenderer::submit(drawable, states);
+	}
+
+	bool StatsRenderTarget::isForwarding() const
+	{
+		return !nullTarget;
+	}
+
+	const RenderStats& StatsRenderTarget::getStats() const
+	{
+		return stats;
+	}
+
+	void StatsRenderTarget::reset()
+	{
+		stats.reset();
+		lastTexture = nullptr;
+		hasLastTexture = false;
+	}
+
+	void StatsRenderTarget::draw(const UIElement& element, const sf::RenderStates& states)
+	{
+		RenderStats::ElementStats& elementStats = stats.elementTypes[typeid(element)];
+		elementStats.elements++;
+
+		drawing.push_back(&elementStats);
+		BatchRenderer::draw(element, states);
+		drawing.pop_back();
+	}
+
+	void StatsRenderTarget::append(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states, const sf::Color& color)
+	{
+		if (!drawing.empty())
+		{
+			drawing.back()->appends++;
+			drawing.back()->vertices += vertexCount;
+		}
+
+		BatchRenderer::append(vertices, vertexCount, type, states, color);
+	}
+} // namespace uie
\ No newline at end of file
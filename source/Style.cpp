@@ -0,0 +1,93 @@
+#include <UIElements/Style.hpp>
+
+namespace
+{
+	// Everything except the colors, which are the only attributes that can change without a relayout
+	bool affectsLayout(const uie::RoundedRectangle::Attributes& a, const uie::RoundedRectangle::Attributes& b)
+	{
+		return a.cornerRadius != b.cornerRadius || a.cornerPointCount != b.cornerPointCount || a.texture != b.texture ||
+			a.textureRect != b.textureRect || a.outlineThickness != b.outlineThickness;
+	}
+
+	bool affectsLayout(const uie::Text::Attributes& a, const uie::Text::Attributes& b)
+	{
+		return a.letterSpacing != b.letterSpacing || a.lineSpacing != b.lineSpacing || a.style != b.style ||
+			a.outlineThickness != b.outlineThickness || a.snap != b.snap;
+	}
+} // namespace
+
+namespace uie
+{
+	std::uint64_t Style::generation = 0;
+
+	Style::Style(const RoundedRectangle::Attributes& rectangleAttributes, const Text::Attributes& textAttributes)
+		: rectangleAttributes(rectangleAttributes), textAttributes(textAttributes)
+	{
+
+	}
+
+	void Style::changed(bool affectsLayout)
+	{
+		version++;
+		generation++;
+
+		if (affectsLayout)
+			layoutVersion = version;
+	}
+
+	const RoundedRectangle::Attributes& Style::getRectangleAttributes() const
+	{
+		return rectangleAttributes;
+	}
+
+	void Style::setRectangleAttributes(const RoundedRectangle::Attributes& attributes)
+	{
+		bool layout = affectsLayout(rectangleAttributes, attributes);
+		rectangleAttributes = attributes;
+		changed(layout);
+	}
+
+	const Text::Attributes& Style::getTextAttributes() const
+	{
+		return textAttributes;
+	}
+
+	void Style::setTextAttributes(const Text::Attributes& attributes)
+	{
+		bool layout = affectsLayout(textAttributes, attributes);
+		textAttributes = attributes;
+		changed(layout);
+	}
+
+	std::uint64_t Style::getVersion() const
+	{
+		return version;
+	}
+
+	unsigned int Style::apply(RoundedRectangle& rectangle, Text& text, std::uint64_t& appliedVersion) const
+	{
+		if (appliedVersion == version)
+			return 0;
+
+		if (appliedVersion < layoutVersion)
+		{
+			rectangle.setAttributes(rectangleAttributes);
+			text.setAttributes(textAttributes);
+			appliedVersion = version;
+			return LayoutDirty | PaintDirty;
+		}
+
+		rectangle.setFillColor(rectangleAttributes.fillColor);
+		rectangle.setOutlineColor(rectangleAttributes.outlineColor);
+		text.setFillColor(textAttributes.fillColor);
+		text.setOutlineColor(textAttributes.outlineColor);
+		appliedVersion = version;
+
+		return PaintDirty;
+	}
+
+	std::uint64_t Style::getGeneration()
+	{
+		return generation;
+	}
+} // namespace uie
\ No newline at end of file
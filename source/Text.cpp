@@ -1,4 +1,7 @@
 #include <UIElements/Text.hpp>
+#include <UIElements/BatchRenderer.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <stdexcept>
 
 namespace uie
 {
@@ -28,19 +31,48 @@ namespace uie
 		allowSnapping(attributes.snap);
 	}
 
+	void Text::ensureGeometryUpdate() const
+	{
+		if (!geometryNeedUpdate)
+			return;
+
+		geometryNeedUpdate = false;
+		layout = getTextLayout(label);
+	}
+
+	const sf::Vector2f& Text::getSnapOffset(const sf::Transform& transform) const
+	{
+		const float* matrix = transform.getMatrix();
+		sf::Vector2f translation = { matrix[12], matrix[13] };
+
+		if (snapNeedUpdate || translation != snapTranslation)
+		{
+			sf::Vector2f position = transform.transformPoint(label.getTransform().transformPoint(getLocalBounds().getPosition()));
+			sf::Vector2f snapped = { (float)(int)(position.x + 0.5f), (float)(int)(position.y + 0.5f) };
+			snapOffset = snapped - position;
+			snapTranslation = translation;
+			snapNeedUpdate = false;
+		}
+
+		return snapOffset;
+	}
+
 	void Text::allowSnapping(bool allowed)
 	{
 		snap = allowed;
+		markDirty(PaintDirty);
 	}
 
 	sf::FloatRect Text::getLocalBounds() const
 	{
-		return label.getLocalBounds();
+		ensureGeometryUpdate();
+		return layout->bounds;
 	}
 
 	sf::FloatRect Text::getGlobalBounds() const
 	{
-		return label.getGlobalBounds();
+		sf::FloatRect bounds = label.getTransform().transformRect(getLocalBounds());
+		return { bounds.getPosition() + getParentOffset(), bounds.getSize() };
 	}
 
 	sf::Vector2f Text::getPosition() const
@@ -50,7 +82,9 @@ namespace uie
 
 	void Text::setPosition(const sf::Vector2f& position)
 	{
-		label.setPosition(position - getLocalBounds().getPosition());
+		label.setPosition(position - getParentOffset() - getLocalBounds().getPosition());
+		snapNeedUpdate = true;
+		markDirty();
 	}
 
 	sf::Vector2f Text::getSize() const
@@ -60,12 +94,14 @@ namespace uie
 
 	void Text::setSize(const sf::Vector2f& size)
 	{
-		throw std::exception("setSize() is not implemented, use setCharacterSize() instead");
+		throw std::logic_error("setSize() is not implemented, use setCharacterSize() instead");
 	}
 
 	void Text::move(const sf::Vector2f& offset)
 	{
 		label.move(offset);
+		snapNeedUpdate = true;
+		markDirty();
 	}
 
 	bool Text::intersects(const sf::Vector2f& point) const
@@ -81,15 +117,34 @@ namespace uie
 	void Text::draw(sf::RenderTarget& target, sf::RenderStates states) const
 	{
 		if (snap)
-		{
-			sf::Text temp(label);
-			sf::Vector2f position = getPosition();
-			position = { (float)(int)(position.x + 0.5f), (float)(int)(position.y + 0.5f) };
-			temp.setPosition(position - getLocalBounds().getPosition());
-			target.draw(temp, states);
-		}
-		else
-			target.draw(label, states);
+			states.transform.translate(getSnapOffset(states.transform));
+
+		target.draw(label, states);
+	}
+
+	void Text::batch(BatchRenderer& renderer, sf::RenderStates states) const
+	{
+		const sf::Font* font = label.getFont();
+
+		if (!font)
+			return;
+
+		ensureGeometryUpdate();
+
+		if (snap)
+			states.transform.translate(getSnapOffset(states.transform));
+
+		states.transform *= label.getTransform();
+		states.texture = &font->getTexture(label.getCharacterSize());
+
+		const std::vector<sf::Vertex>& outlineVertices = layout->outlineVertices;
+		const std::vector<sf::Vertex>& fillVertices = layout->fillVertices;
+
+		if (!outlineVertices.empty() && label.getOutlineColor().a != 0)
+			renderer.append(outlineVertices.data(), outlineVertices.size(), sf::Triangles, states, label.getOutlineColor());
+
+		if (label.getFillColor().a != 0)
+			renderer.append(fillVertices.data(), fillVertices.size(), sf::Triangles, states, label.getFillColor());
 	}
 
 	const sf::String& Text::getString() const
@@ -100,6 +155,9 @@ namespace uie
 	void Text::setString(const sf::String& string)
 	{
 		label.setString(string);
+		geometryNeedUpdate = true;
+		snapNeedUpdate = true;
+		markDirty();
 	}
 
 	const sf::Font* Text::getFont() const
@@ -110,6 +168,9 @@ namespace uie
 	void Text::setFont(const sf::Font& font)
 	{
 		label.setFont(font);
+		geometryNeedUpdate = true;
+		snapNeedUpdate = true;
+		markDirty();
 	}
 
 	unsigned int Text::getCharacterSize() const
@@ -120,6 +181,9 @@ namespace uie
 	void Text::setCharacterSize(unsigned int size)
 	{
 		label.setCharacterSize(size);
+		geometryNeedUpdate = true;
+		snapNeedUpdate = true;
+		markDirty();
 	}
 
 	float Text::getLetterSpacing() const
@@ -130,6 +194,9 @@ namespace uie
 	void Text::setLetterSpacing(float spacingFactor)
 	{
 		label.setLetterSpacing(spacingFactor);
+		geometryNeedUpdate = true;
+		snapNeedUpdate = true;
+		markDirty();
 	}
 
 	float Text::getLineSpacing() const
@@ -140,6 +207,9 @@ namespace uie
 	void Text::setLineSpacing(float spacingFactor)
 	{
 		label.setLineSpacing(spacingFactor);
+		geometryNeedUpdate = true;
+		snapNeedUpdate = true;
+		markDirty();
 	}
 
 	unsigned int Text::getStyle() const
@@ -150,6 +220,9 @@ namespace uie
 	void Text::setStyle(unsigned int style)
 	{
 		label.setStyle(style);
+		geometryNeedUpdate = true;
+		snapNeedUpdate = true;
+		markDirty();
 	}
 
 	const sf::Color& Text::getFillColor() const
@@ -160,6 +233,7 @@ namespace uie
 	void Text::setFillColor(const sf::Color& color)
 	{
 		label.setFillColor(color);
+		markDirty(PaintDirty);
 	}
 
 	const sf::Color& Text::getOutlineColor() const
@@ -170,6 +244,7 @@ namespace uie
 	void Text::setOutlineColor(const sf::Color& color)
 	{
 		label.setOutlineColor(color);
+		markDirty(PaintDirty);
 	}
 
 	float Text::getOutlineThickness() const
@@ -180,5 +255,8 @@ namespace uie
 	void Text::setOutlineThickness(float thickness)
 	{
 		label.setOutlineThickness(thickness);
+		geometryNeedUpdate = true;
+		snapNeedUpdate = true;
+		markDirty();
 	}
 } // namespace uie
\ No newline at end of file
@@ -0,0 +1,357 @@
+#include <UIElements/TextLayout.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+
+namespace
+{
+	// Add an underline or strike through line, as done by sf::Text
+	void addLine(std::vector<sf::Vertex>& vertices, float lineLength, float lineTop, float offset, float thickness, float outlineThickness = 0)
+	{
+		float top = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+		float bottom = top + std::floor(thickness + 0.5f);
+
+		vertices.emplace_back(sf::Vector2f(-outlineThickness, top - outlineThickness), sf::Vector2f(1, 1));
+		vertices.emplace_back(sf::Vector2f(lineLength + outlineThickness, top - outlineThickness), sf::Vector2f(1, 1));
+		vertices.emplace_back(sf::Vector2f(-outlineThickness, bottom + outlineThickness), sf::Vector2f(1, 1));
+		vertices.emplace_back(sf::Vector2f(-outlineThickness, bottom + outlineThickness), sf::Vector2f(1, 1));
+		vertices.emplace_back(sf::Vector2f(lineLength + outlineThickness, top - outlineThickness), sf::Vector2f(1, 1));
+		vertices.emplace_back(sf::Vector2f(lineLength + outlineThickness, bottom + outlineThickness), sf::Vector2f(1, 1));
+	}
+
+	// Add a glyph quad, as done by sf::Text
+	void addGlyphQuad(std::vector<sf::Vertex>& vertices, const sf::Vector2f& position, const sf::Glyph& glyph, float italicShear)
+	{
+		float padding = 1.0f;
+
+		float left = glyph.bounds.left - padding;
+		float top = glyph.bounds.top - padding;
+		float right = glyph.bounds.left + glyph.bounds.width + padding;
+		float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+		float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+		float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+		float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+		float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+		vertices.emplace_back(sf::Vector2f(position.x + left - italicShear * top, position.y + top), sf::Vector2f(u1, v1));
+		vertices.emplace_back(sf::Vector2f(position.x + right - italicShear * top, position.y + top), sf::Vector2f(u2, v1));
+		vertices.emplace_back(sf::Vector2f(position.x + left - italicShear * bottom, position.y + bottom), sf::Vector2f(u1, v2));
+		vertices.emplace_back(sf::Vector2f(position.x + left - italicShear * bottom, position.y + bottom), sf::Vector2f(u1, v2));
+		vertices.emplace_back(sf::Vector2f(position.x + right - italicShear * top, position.y + top), sf::Vector2f(u2, v1));
+		vertices.emplace_back(sf::Vector2f(position.x + right - italicShear * bottom, position.y + bottom), sf::Vector2f(u2, v2));
+	}
+
+	// Mix bytes into a 64 bit FNV-1a hash
+	void hashBytes(std::uint64_t& hash, const void* data, std::size_t size)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+		for (std::size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ull;
+		}
+	}
+
+	template <typename T>
+	void hashValue(std::uint64_t& hash, const T& value)
+	{
+		hashBytes(hash, &value, sizeof(value));
+	}
+
+	struct Key
+	{
+		sf::String string;
+		const sf::Font* font = nullptr;
+		unsigned int characterSize = 0;
+		unsigned int style = 0;
+		float letterSpacing = 0;
+		float lineSpacing = 0;
+		float outlineThickness = 0;
+	};
+
+	struct Entry
+	{
+		Key key;
+		std::uint64_t hash = 0;
+		std::shared_ptr<const uie::TextLayout> layout;
+	};
+
+	struct Cache
+	{
+		std::list<Entry> entries;											// The entries, the most recently used first
+		std::unordered_multimap<std::uint64_t, std::list<Entry>::iterator> lookup;	// The entries by hash
+		std::size_t capacity = 1024;										// The maximum number of entries
+		std::size_t hits = 0;												// The number of layouts found in the cache
+		std::size_t misses = 0;												// The number of layouts which had to be computed
+	};
+
+	Cache cache;	// The layouts shared by all texts
+
+	// Hash everything a layout depends on
+	std::uint64_t getHash(const sf::Text& text)
+	{
+		std::uint64_t hash = 14695981039346656037ull;
+		const sf::String& string = text.getString();
+
+		hashBytes(hash, string.getData(), string.getSize() * sizeof(sf::Uint32));
+		hashValue(hash, text.getFont());
+		hashValue(hash, text.getCharacterSize());
+		hashValue(hash, text.getStyle());
+		hashValue(hash, text.getLetterSpacing());
+		hashValue(hash, text.getLineSpacing());
+		hashValue(hash, text.getOutlineThickness());
+
+		return hash;
+	}
+
+	// Check if a key describes a text
+	bool matches(const Key& key, const sf::Text& text)
+	{
+		return key.font == text.getFont()
+			&& key.characterSize == text.getCharacterSize()
+			&& key.style == text.getStyle()
+			&& key.letterSpacing == text.getLetterSpacing()
+			&& key.lineSpacing == text.getLineSpacing()
+			&& key.outlineThickness == text.getOutlineThickness()
+			&& key.string == text.getString();
+	}
+
+	// Lay out the glyphs of a text the same way sf::Text does it
+	std::shared_ptr<const uie::TextLayout> build(const sf::Text& text)
+	{
+		auto layout = std::make_shared<uie::TextLayout>();
+
+		const sf::Font* font = text.getFont();
+		const sf::String& string = text.getString();
+
+		unsigned int characterSize = text.getCharacterSize();
+		unsigned int style = text.getStyle();
+		float outlineThickness = text.getOutlineThickness();
+
+		bool isBold = style & sf::Text::Bold;
+		bool isUnderlined = style & sf::Text::Underlined;
+		bool isStrikeThrough = style & sf::Text::StrikeThrough;
+		float italicShear = (style & sf::Text::Italic) ? 0.209f : 0.0f;
+		float underlineOffset = font->getUnderlinePosition(characterSize);
+		float underlineThickness = font->getUnderlineThickness(characterSize);
+
+		sf::FloatRect xBounds = font->getGlyph(L'x', characterSize, isBold).bounds;
+		float strikeThroughOffset = xBounds.top + xBounds.height / 2.0f;
+
+		float whitespaceWidth = font->getGlyph(L' ', characterSize, isBold).advance;
+		float letterSpacing = (whitespaceWidth / 3.0f) * (text.getLetterSpacing() - 1.0f);
+		whitespaceWidth += letterSpacing;
+		float lineSpacing = font->getLineSpacing(characterSize) * text.getLineSpacing();
+		float x = 0.0f;
+		float y = static_cast<float>(characterSize);
+
+		// The boundaries start the same way as in sf::Text, so both give the same result
+		float minX = static_cast<float>(characterSize);
+		float minY = static_cast<float>(characterSize);
+		float maxX = 0.0f;
+		float maxY = 0.0f;
+
+		auto addLines = [&](float offset)
+		{
+			addLine(layout->fillVertices, x, y, offset, underlineThickness);
+
+			if (outlineThickness != 0)
+				addLine(layout->outlineVertices, x, y, offset, underlineThickness, outlineThickness);
+		};
+
+		sf::Uint32 prevChar = 0;
+
+		for (std::size_t i = 0; i < string.getSize(); i++)
+		{
+			sf::Uint32 curChar = string[i];
+
+			if (curChar == L'\r')
+				continue;
+
+			x += font->getKerning(prevChar, curChar, characterSize, isBold);
+
+			if (curChar == L'\n' && prevChar != L'\n')
+			{
+				if (isUnderlined)
+					addLines(underlineOffset);
+
+				if (isStrikeThrough)
+					addLines(strikeThroughOffset);
+			}
+
+			prevChar = curChar;
+
+			if (curChar == L' ' || curChar == L'\n' || curChar == L'\t')
+			{
+				minX = std::min(minX, x);
+				minY = std::min(minY, y);
+
+				switch (curChar)
+				{
+				case L' ': x += whitespaceWidth; break;
+				case L'\t': x += whitespaceWidth * 4; break;
+				case L'\n': y += lineSpacing; x = 0; break;
+				}
+
+				maxX = std::max(maxX, x);
+				maxY = std::max(maxY, y);
+
+				continue;
+			}
+
+			if (outlineThickness != 0)
+				addGlyphQuad(layout->outlineVertices, { x, y }, font->getGlyph(curChar, characterSize, isBold, outlineThickness), italicShear);
+
+			const sf::Glyph& glyph = font->getGlyph(curChar, characterSize, isBold);
+			addGlyphQuad(layout->fillVertices, { x, y }, glyph, italicShear);
+
+			float left = glyph.bounds.left;
+			float top = glyph.bounds.top;
+			float right = glyph.bounds.left + glyph.bounds.width;
+			float bottom = glyph.bounds.top + glyph.bounds.height;
+
+			minX = std::min(minX, x + left - italicShear * bottom);
+			maxX = std::max(maxX, x + right - italicShear * top);
+			minY = std::min(minY, y + top);
+			maxY = std::max(maxY, y + bottom);
+
+			x += glyph.advance + letterSpacing;
+		}
+
+		if (x > 0)
+		{
+			if (isUnderlined)
+				addLines(underlineOffset);
+
+			if (isStrikeThrough)
+				addLines(strikeThroughOffset);
+		}
+
+		if (outlineThickness != 0)
+		{
+			float outline = std::abs(std::ceil(outlineThickness));
+			minX -= outline;
+			maxX += outline;
+			minY -= outline;
+			maxY += outline;
+		}
+
+		layout->bounds = { minX, minY, maxX - minX, maxY - minY };
+
+		return layout;
+	}
+
+	// Remove the least recently used entries until the cache fits its capacity
+	void evict()
+	{
+		while (cache.entries.size() > cache.capacity)
+		{
+			auto range = cache.lookup.equal_range(cache.entries.back().hash);
+			auto last = std::prev(cache.entries.end());
+
+			for (auto it = range.first; it != range.second; it++)
+			{
+				if (it->second == last)
+				{
+					cache.lookup.erase(it);
+					break;
+				}
+			}
+
+			cache.entries.pop_back();
+		}
+	}
+} // namespace
+
+namespace uie
+{
+	std::shared_ptr<const TextLayout> getTextLayout(const sf::Text& text)
+	{
+		static const auto empty = std::make_shared<const TextLayout>();
+
+		if (!text.getFont() || text.getString().isEmpty())
+			return empty;
+
+		std::uint64_t hash = getHash(text);
+		auto range = cache.lookup.equal_range(hash);
+
+		for (auto it = range.first; it != range.second; it++)
+		{
+			if (matches(it->second->key, text))
+			{
+				// Move the entry to the front, splicing keeps the iterators valid and does not allocate
+				cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+				cache.hits++;
+
+				return it->second->layout;
+			}
+		}
+
+		cache.misses++;
+		std::shared_ptr<const TextLayout> layout = build(text);
+
+		if (cache.capacity == 0)
+			return layout;
+
+		Key key = { text.getString(), text.getFont(), text.getCharacterSize(), text.getStyle(),
+			text.getLetterSpacing(), text.getLineSpacing(), text.getOutlineThickness() };
+
+		cache.entries.push_front({ std::move(key), hash, layout });
+		cache.lookup.emplace(hash, cache.entries.begin());
+		evict();
+
+		return layout;
+	}
+
+	void clearTextLayouts(const sf::Font& font)
+	{
+		for (auto it = cache.lookup.begin(); it != cache.lookup.end();)
+		{
+			if (it->second->key.font == &font)
+			{
+				cache.entries.erase(it->second);
+				it = cache.lookup.erase(it);
+			}
+			else
+			{
+				it++;
+			}
+		}
+	}
+
+	void clearTextLayouts()
+	{
+		cache.entries.clear();
+		cache.lookup.clear();
+	}
+
+	std::size_t getTextLayoutCapacity()
+	{
+		return cache.capacity;
+	}
+
+	void setTextLayoutCapacity(std::size_t capacity)
+	{
+		cache.capacity = capacity;
+		evict();
+	}
+
+	std::size_t getTextLayoutCount()
+	{
+		return cache.entries.size();
+	}
+
+	std::size_t getTextLayoutHits()
+	{
+		return cache.hits;
+	}
+
+	std::size_t getTextLayoutMisses()
+	{
+		return cache.misses;
+	}
+} // namespace uie
\ No newline at end of file
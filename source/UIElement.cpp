@@ -0,0 +1,264 @@
+#include <UIElements/UIElement.hpp>
+#include <UIElements/BatchRenderer.hpp>
+#include <UIElements/Style.hpp>
+#include <algorithm>
+
+namespace uie
+{
+	std::uint64_t UIElement::layoutGeneration = 0;
+
+	UIElement::UIElement(const UIElement&)
+	{
+
+	}
+
+	UIElement::UIElement(UIElement&& other) noexcept
+		: dirtyFlags(other.dirtyFlags)
+	{
+
+	}
+
+	UIElement& UIElement::operator=(const UIElement&)
+	{
+		markDirty();
+		return *this;
+	}
+
+	UIElement& UIElement::operator=(UIElement&&) noexcept
+	{
+		markDirty();
+		return *this;
+	}
+
+	void UIElement::markDirty(unsigned int flags) const
+	{
+		if (flags & LayoutDirty)
+			layoutGeneration++;
+
+		// Always walk up to the root, a parent may have been cleared while a child was not
+		for (const UIElement* element = this; element; element = element->parent)
+		{
+			element->dirtyFlags |= flags;
+
+			if (flags & LayoutDirty)
+			{
+				element->layoutBoundsValid = false;
+				element->measureValid = false;
+				element->arrangeValid = false;
+
+				if (element->parent)
+					element->parent->childLayoutChanged(*element);
+			}
+		}
+	}
+
+	void UIElement::batch(BatchRenderer& renderer, sf::RenderStates states) const
+	{
+		renderer.drawUnbatched(*this, states);
+	}
+
+	sf::Vector2f UIElement::measureOverride(const sf::Vector2f&)
+	{
+		return getCachedLayoutBounds().getSize();
+	}
+
+	void UIElement::arrangeOverride(const sf::FloatRect& rect)
+	{
+		sf::FloatRect bounds = getCachedLayoutBounds();
+
+		if (rect.getPosition() != bounds.getPosition())
+			move(rect.getPosition() - bounds.getPosition());
+
+		// The global boundaries can be larger than the size, for example because of an outline
+		if (rect.getSize() != bounds.getSize())
+			setSize(getSize() + rect.getSize() - bounds.getSize());
+	}
+
+	void UIElement::updateLayout()
+	{
+		// A style changed since the last layout, so the whole tree is restyled in one pass
+		if (appliedStyleGeneration != Style::getGeneration())
+		{
+			appliedStyleGeneration = Style::getGeneration();
+			applyStyles();
+		}
+
+		if (!isLayoutDirty())
+			return;
+
+		sf::FloatRect bounds = getCachedLayoutBounds();
+		arrange({ bounds.getPosition(), measure(bounds.getSize()) });
+	}
+
+	sf::Vector2f UIElement::measure(const sf::Vector2f& available)
+	{
+		if (measureValid && available == measuredAvailable)
+			return measuredSize;
+
+		measuredSize = measureOverride(available);
+		measuredAvailable = available;
+		measureValid = true;
+
+		return measuredSize;
+	}
+
+	void UIElement::arrange(const sf::FloatRect& rect)
+	{
+		if (arrangeValid && rect == arrangedRect && !isLayoutDirty())
+			return;
+
+		sf::Vector2f size = getCachedLayoutBounds().getSize();
+		bool measured = measureValid;
+
+		arrangeOverride(rect);
+
+		// Only moving the ui-element does not change what it measures
+		if (measured && getCachedLayoutBounds().getSize() == size)
+			measureValid = true;
+
+		arrangedRect = rect;
+		arrangeValid = true;
+		clearDirty(LayoutDirty);
+	}
+
+	sf::Vector2f UIElement::getContentOffset() const
+	{
+		return {};
+	}
+
+	void UIElement::childLayoutChanged(const UIElement&) const
+	{
+
+	}
+
+	sf::Vector2f UIElement::getParentOffset() const
+	{
+		sf::Vector2f offset;
+
+		for (const UIElement* element = parent; element; element = element->parent)
+			offset += element->getContentOffset();
+
+		return offset;
+	}
+
+	sf::FloatRect UIElement::getLayoutBounds() const
+	{
+		sf::FloatRect bounds = getGlobalBounds();
+		return { bounds.getPosition() - getParentOffset(), bounds.getSize() };
+	}
+
+	sf::Vector2f UIElement::getLayoutPosition() const
+	{
+		return getPosition() - getParentOffset();
+	}
+
+	const sf::FloatRect& UIElement::getCachedLayoutBounds() const
+	{
+		if (!layoutBoundsValid)
+		{
+			cachedLayoutBounds = getLayoutBounds();
+			layoutBoundsValid = true;
+		}
+
+		return cachedLayoutBounds;
+	}
+
+	sf::FloatRect UIElement::getCachedGlobalBounds() const
+	{
+		const sf::FloatRect& bounds = getCachedLayoutBounds();
+		return { bounds.getPosition() + getParentOffset(), bounds.getSize() };
+	}
+
+	const UIElement* UIElement::getParent() const
+	{
+		return parent;
+	}
+
+	void UIElement::setParent(const UIElement* parent) const
+	{
+		if (this->parent == parent)
+			return;
+
+		// Moving to another parent changes the coordinates the ui-element is in
+		this->parent = parent;
+		layoutGeneration++;
+
+		if (parent && dirtyFlags != Clean)
+			parent->markDirty(dirtyFlags);
+	}
+
+	unsigned int UIElement::getDirtyFlags() const
+	{
+		return dirtyFlags;
+	}
+
+	bool UIElement::isLayoutDirty() const
+	{
+		return dirtyFlags & LayoutDirty;
+	}
+
+	bool UIElement::isPaintDirty() const
+	{
+		return dirtyFlags & PaintDirty;
+	}
+
+	void UIElement::clearDirty(unsigned int flags) const
+	{
+		dirtyFlags &= ~flags;
+	}
+
+	std::uint64_t UIElement::getLayoutGeneration()
+	{
+		return layoutGeneration;
+	}
+
+	UIElement* UIElement::hitTest(const sf::Vector2f& point, sf::Vector2f* localPoint)
+	{
+		// The point is in the layout coordinates, intersects takes global coordinates
+		if (!intersects(point + getParentOffset()))
+			return nullptr;
+
+		if (localPoint)
+			*localPoint = point;
+
+		return this;
+	}
+
+	void UIElement::hitTest(std::span<const sf::Vector2f> points, std::span<UIElement*> hits)
+	{
+		std::size_t count = std::min(points.size(), hits.size());
+
+		for (std::size_t i = 0; i < count; i++)
+			hits[i] = hitTest(points[i]);
+	}
+
+	void UIElement::applyStyles()
+	{
+
+	}
+
+	void UIElement::mouseEntered()
+	{
+
+	}
+
+	void UIElement::mouseLeft()
+	{
+
+	}
+
+	void UIElement::mousePressed(sf::Mouse::Button)
+	{
+
+	}
+
+	void UIElement::mouseReleased(sf::Mouse::Button)
+	{
+
+	}
+
+	void UIElement::clicked(sf::Mouse::Button)
+	{
+
+	}
+} // namespace uie
\ No newline at end of file